@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+
+struct Config
+{
+    int value = 1;
+};
+
+struct Session
+{
+    explicit Session(const Config& config)
+        : value(config.value)
+    {
+    }
+
+    int value;
+};
+
+using SingletonService = dipp::injected<Config, dipp::service_lifetime::singleton>;
+using ScopedService =
+    dipp::injected<Session, dipp::service_lifetime::scoped, dipp::dependency<SingletonService>>;
+using TransientService = dipp::
+    injected<Session, dipp::service_lifetime::transient, dipp::dependency<SingletonService>, 1>;
+
+static dipp::service_collection make_collection()
+{
+    dipp::service_collection collection;
+
+    collection.add<SingletonService>();
+    collection.add<ScopedService>();
+    collection.add<TransientService>();
+
+    return collection;
+}
+
+// Dipp Benchmarks
+
+static void BM_DippRegistration(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        dipp::service_collection collection;
+        collection.add<SingletonService>();
+        benchmark::DoNotOptimize(collection);
+    }
+}
+BENCHMARK(BM_DippRegistration);
+
+static void BM_DippCreateScope(benchmark::State& state)
+{
+    dipp::service_provider services(make_collection());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto scope = services.create_scope();
+        benchmark::DoNotOptimize(scope);
+    }
+}
+BENCHMARK(BM_DippCreateScope);
+
+template<typename ServiceTy>
+static void BM_DippFirstGet(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        // a fresh provider and scope, so nothing is cached yet
+        state.PauseTiming();
+        allocations.pause();
+        auto services = std::make_unique<dipp::service_provider>(make_collection());
+        auto scope = std::make_unique<dipp::service_scope>(services->create_scope());
+        allocations.resume();
+        state.ResumeTiming();
+
+        auto service = scope->get<ServiceTy>();
+        benchmark::DoNotOptimize(service);
+
+        state.PauseTiming();
+        allocations.pause();
+        scope.reset();
+        services.reset();
+        allocations.resume();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_DippFirstGet<SingletonService>)->Name("BM_DippFirstGetSingleton");
+BENCHMARK(BM_DippFirstGet<ScopedService>)->Name("BM_DippFirstGetScoped");
+BENCHMARK(BM_DippFirstGet<TransientService>)->Name("BM_DippFirstGetTransient");
+
+template<typename ServiceTy>
+static void BM_DippRepeatGet(benchmark::State& state)
+{
+    dipp::service_provider services(make_collection());
+    auto scope = services.create_scope();
+    benchmark::DoNotOptimize(scope.get<ServiceTy>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = scope.get<ServiceTy>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippRepeatGet<SingletonService>)->Name("BM_DippRepeatGetSingleton");
+BENCHMARK(BM_DippRepeatGet<ScopedService>)->Name("BM_DippRepeatGetScoped");
+BENCHMARK(BM_DippRepeatGet<TransientService>)->Name("BM_DippRepeatGetTransient");
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
 #include <fruit/fruit.h>
 #include <kangaru/kangaru.hpp>
 #include <dipp/dipp.hpp>
@@ -186,6 +187,7 @@ struct DippConfiguration
 // Fruit Benchmarks
 static void BM_FruitContainerCreation(benchmark::State& state)
 {
+    dipp::support::benchmark_allocations allocations(state);
     for (auto _ : state)
     {
         auto injector = fruit::Injector(UserServiceComponent::getComponent);
@@ -200,6 +202,7 @@ static void BM_FruitResolution(benchmark::State& state)
     auto injector = fruit::Injector(UserServiceComponent::getComponent);
     state.ResumeTiming();
 
+    dipp::support::benchmark_allocations allocations(state);
     for (auto _ : state)
     {
         IUserService* service = injector.get<IUserService*>();
@@ -211,6 +214,7 @@ BENCHMARK(BM_FruitResolution);
 // Kangaru Benchmarks
 static void BM_KangaruContainerCreation(benchmark::State& state)
 {
+    dipp::support::benchmark_allocations allocations(state);
     for (auto _ : state)
     {
         kgr::container container;
@@ -225,6 +229,7 @@ static void BM_KangaruResolution(benchmark::State& state)
     kgr::container container;
     state.ResumeTiming();
 
+    dipp::support::benchmark_allocations allocations(state);
     for (auto _ : state)
     {
         auto service = container.service<IUserServiceService>();
@@ -236,6 +241,7 @@ BENCHMARK(BM_KangaruResolution);
 // Dipp Benchmarks
 static void BM_DippContainerCreation(benchmark::State& state)
 {
+    dipp::support::benchmark_allocations allocations(state);
     for (auto _ : state)
     {
         auto services = DippConfiguration::setup();
@@ -250,6 +256,7 @@ static void BM_DippResolution(benchmark::State& state)
     auto services = DippConfiguration::setup();
     state.ResumeTiming();
 
+    dipp::support::benchmark_allocations allocations(state);
     for (auto _ : state)
     {
         auto service = services.get<DippUserServiceService>();
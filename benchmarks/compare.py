@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Compares two Google Benchmark JSON runs and reports regressions.
+
+Produce the runs with:
+    xmake run benchmark_dipp_services --benchmark_out=base.json --benchmark_out_format=json
+
+Then compare them:
+    python3 benchmarks/compare.py base.json head.json --threshold 5
+
+Exits with 1 if any benchmark got slower, or allocates more, than the threshold allows.
+"""
+
+import argparse
+import json
+import sys
+
+COUNTERS = ("allocs/op", "bytes/op")
+
+
+def load_benchmarks(path):
+    with open(path, encoding="utf-8") as file:
+        report = json.load(file)
+
+    benchmarks = {}
+    for benchmark in report.get("benchmarks", []):
+        # with repetitions, only compare the aggregated mean
+        if benchmark.get("run_type") == "aggregate" and benchmark.get("aggregate_name") != "mean":
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        benchmarks[name] = benchmark
+    return benchmarks
+
+
+def change(base, head):
+    if base == 0:
+        return 0.0 if head == 0 else float("inf")
+    return (head - base) / base * 100.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("base", help="JSON output of the reference run")
+    parser.add_argument("head", help="JSON output of the run to check")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="allowed slowdown in percent (default: 5)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="cpu_time",
+                        help="time measurement to compare (default: cpu_time)")
+    args = parser.parse_args()
+
+    base = load_benchmarks(args.base)
+    head = load_benchmarks(args.head)
+
+    regressions = 0
+    print(f"{'Benchmark':<50} {'Base':>12} {'Head':>12} {'Change':>9}")
+    for name in sorted(base.keys() & head.keys()):
+        base_time = base[name][args.metric]
+        head_time = head[name][args.metric]
+        time_change = change(base_time, head_time)
+
+        flags = []
+        if time_change > args.threshold:
+            flags.append("SLOWER")
+        for counter in COUNTERS:
+            if counter in base[name] and counter in head[name]:
+                if head[name][counter] > base[name][counter]:
+                    flags.append(f"MORE {counter}")
+
+        regressions += bool(flags)
+        unit = head[name].get("time_unit", "ns")
+        print(f"{name:<50} {base_time:>10.2f}{unit} {head_time:>10.2f}{unit} "
+              f"{time_change:>+8.1f}% {' '.join(flags)}".rstrip())
+
+    for name in sorted(base.keys() - head.keys()):
+        print(f"{name:<50} removed")
+    for name in sorted(head.keys() - base.keys()):
+        print(f"{name:<50} added")
+
+    if regressions:
+        print(f"\n{regressions} regression(s) above {args.threshold}%")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
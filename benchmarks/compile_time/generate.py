@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Generates a translation unit registering and resolving a synthetic service graph.
+
+The services are laid out in layers, every service depending on up to fan-out services of the
+previous layer. Lower layers are singletons, the top layer alternates between scoped and transient
+services so every lifetime's loader is instantiated.
+
+    python3 benchmarks/compile_time/generate.py --services 400 --depth 8 --fan-out 3 -o graph.cpp
+"""
+
+import argparse
+import math
+import sys
+
+
+def generate(services, depth, fan_out):
+    depth = max(1, min(depth, services)) if services else 1
+    width = math.ceil(services / depth) if services else 0
+    layers = [list(range(start, min(start + width, services)))
+              for start in range(0, services, width)] if services else []
+
+    lines = ["#include <dipp/dipp.hpp>", ""]
+
+    dependencies = {}
+    for layer_index, layer in enumerate(layers):
+        previous = layers[layer_index - 1] if layer_index else []
+        top = layer_index == len(layers) - 1 and layer_index != 0
+
+        for position, index in enumerate(layer):
+            deps = []
+            for offset in range(min(fan_out, len(previous))):
+                dep = previous[(position + offset * 7) % len(previous)]
+                if dep not in deps:
+                    deps.append(dep)
+            dependencies[index] = deps
+
+            params = ", ".join(f"const Service{dep}& d{n}" for n, dep in enumerate(deps))
+            total = " + ".join(f"d{n}.value" for n in range(len(deps))) or "0"
+
+            lines.append(f"struct Service{index}")
+            lines.append("{")
+            if deps:
+                lines.append(f"    explicit Service{index}({params})")
+                lines.append(f"        : value({total} + 1)")
+                lines.append("    {")
+                lines.append("    }")
+                lines.append("")
+                lines.append("    int value;")
+            else:
+                lines.append("    int value = 1;")
+            lines.append("};")
+
+            if not top:
+                lifetime = "singleton"
+            else:
+                lifetime = "scoped" if index % 2 == 0 else "transient"
+            dependency = ", ".join(f"Service{dep}Injected" for dep in deps)
+            lines.append(f"using Service{index}Injected = dipp::injected<Service{index}, "
+                         f"dipp::service_lifetime::{lifetime}, dipp::dependency<{dependency}>>;")
+            lines.append("")
+
+    lines.append("int main()")
+    lines.append("{")
+    lines.append("    dipp::service_collection collection;")
+    for index in range(services):
+        lines.append(f"    collection.add<Service{index}Injected>();")
+    lines.append("")
+    lines.append("    dipp::service_provider services(std::move(collection));")
+    lines.append("    auto scope = services.create_scope();")
+    lines.append("    int sum = 0;")
+    for index in (layers[-1] if layers else []):
+        lines.append(f"    sum += (*scope.get<Service{index}Injected>())->value;")
+    lines.append("    return sum == 0 ? 1 : 0;")
+    lines.append("}")
+
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--services", type=int, default=100, help="number of services")
+    parser.add_argument("--depth", type=int, default=5, help="number of layers")
+    parser.add_argument("--fan-out", type=int, default=3, help="dependencies per service")
+    parser.add_argument("-o", "--output", help="output file, stdout if omitted")
+    args = parser.parse_args()
+
+    source = generate(args.services, args.depth, args.fan_out)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as file:
+            file.write(source)
+    else:
+        sys.stdout.write(source)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""Measures compile time, peak compiler memory and object code size of generated service graphs.
+
+Every graph is compiled to an object file on its own, the empty graph is the baseline the
+per-service costs are computed from.
+
+    python3 benchmarks/compile_time/measure.py --services 0 100 200 400 --json compile.json
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+from generate import generate
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+
+def run_compiler(command, cwd=None):
+    """Runs the compiler, returning its wall time and peak memory in KiB when available."""
+    start = time.perf_counter()
+    process = subprocess.Popen(command, cwd=cwd)
+
+    if hasattr(os, "wait4"):
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+        # ru_maxrss is in bytes on macOS and in KiB elsewhere
+        peak = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    else:
+        process.wait()
+        peak = None
+
+    elapsed = time.perf_counter() - start
+    if process.returncode != 0:
+        raise RuntimeError(f"compilation failed: {' '.join(command)}")
+    return elapsed, peak
+
+
+def code_size(path):
+    """Sums the text sections of the object file, or its file size without binutils."""
+    size_tool = shutil.which("size")
+    if size_tool:
+        output = subprocess.run([size_tool, "-A", path], capture_output=True, text=True,
+                                check=False).stdout
+        sections = re.findall(r"^(\.text\S*)\s+(\d+)", output, re.MULTILINE)
+        if sections:
+            return sum(int(size) for _, size in sections)
+    return os.path.getsize(path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--services", type=int, nargs="+", default=[0, 50, 100, 200, 400],
+                        help="graph sizes to measure, 0 is always added as baseline")
+    parser.add_argument("--depth", type=int, default=8, help="number of layers")
+    parser.add_argument("--fan-out", type=int, default=3, help="dependencies per service")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="compiler to use")
+    parser.add_argument("--flags", default="-std=c++20 -O2", help="compiler flags")
+    parser.add_argument("--include", default=os.path.join(ROOT, "include"),
+                        help="dipp include directory")
+    parser.add_argument("--json", help="also write the results to this file")
+    args = parser.parse_args()
+
+    sizes = sorted(set(args.services) | {0})
+    results = []
+
+    with tempfile.TemporaryDirectory() as directory:
+        for services in sizes:
+            source = os.path.join(directory, f"graph_{services}.cpp")
+            output = os.path.join(directory, f"graph_{services}.o")
+            with open(source, "w", encoding="utf-8") as file:
+                file.write(generate(services, args.depth, args.fan_out))
+
+            command = [args.cxx, *args.flags.split(), "-I", args.include, "-c", source, "-o", output]
+            elapsed, peak = run_compiler(command)
+            results.append({"services": services, "compile_seconds": elapsed,
+                            "peak_memory_kib": peak, "code_bytes": code_size(output)})
+
+    baseline = results[0]
+    print(f"{'Services':>8} {'Compile':>10} {'Peak memory':>12} {'Code':>12} "
+          f"{'ms/service':>11} {'bytes/service':>14}")
+    for result in results:
+        services = result["services"]
+        if services:
+            result["ms_per_service"] = (
+                (result["compile_seconds"] - baseline["compile_seconds"]) * 1000 / services)
+            result["bytes_per_service"] = (
+                (result["code_bytes"] - baseline["code_bytes"]) / services)
+
+        peak = result["peak_memory_kib"]
+        print(f"{services:>8} {result['compile_seconds']:>9.2f}s "
+              f"{(f'{peak / 1024:.0f} MiB' if peak else 'n/a'):>12} "
+              f"{result['code_bytes']:>12} "
+              f"{result.get('ms_per_service', 0):>11.1f} {result.get('bytes_per_service', 0):>14.0f}")
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as file:
+            json.dump({"depth": args.depth, "fan_out": args.fan_out, "cxx": args.cxx,
+                       "flags": args.flags, "results": results}, file, indent=2)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""Measures the build time of the test suite including dipp/dipp.hpp against importing dipp.
+
+Every test is compiled to an object file twice: as written, and with the dipp include replaced by
+`import dipp;` after its last include. The module interface is built once and counted in the module
+total. GCC (-fmodules-ts) and Clang (--precompile) are supported.
+
+    python3 benchmarks/compile_time/measure_modules.py --cxx clang++ --json modules.json
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+import tempfile
+
+from measure import run_compiler
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+INCLUDE_PATTERN = re.compile(r"^#include <dipp/dipp\.hpp>\n", re.MULTILINE)
+
+
+def is_clang(cxx):
+    return "clang" in os.path.basename(cxx)
+
+
+def to_import(source):
+    """Replaces the dipp include by an import placed after the last include of the file."""
+    source = INCLUDE_PATTERN.sub("", source)
+    includes = list(re.finditer(r"^#include .*\n", source, re.MULTILINE))
+    position = includes[-1].end() if includes else 0
+    return source[:position] + "\nimport dipp;\n" + source[position:]
+
+
+def build_module(args, flags, directory):
+    """Builds the module interface, returning its build time and the flags importers need."""
+    interface = os.path.join(ROOT, "modules", "dipp.cppm")
+    output = os.path.join(directory, "dipp.o")
+
+    if is_clang(args.cxx):
+        pcm = os.path.join(directory, "dipp.pcm")
+        precompile, _ = run_compiler([args.cxx, *flags, "--precompile", interface, "-o", pcm])
+        compile_, _ = run_compiler([args.cxx, *flags, "-c", pcm, "-o", output])
+        return precompile + compile_, [f"-fmodule-file=dipp={pcm}"]
+
+    # gcc writes the compiled module interface to gcm.cache in its working directory
+    elapsed, _ = run_compiler([args.cxx, *flags, "-fmodules-ts", "-x", "c++", "-c", interface,
+                               "-o", output], cwd=directory)
+    return elapsed, ["-fmodules-ts"]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="compiler to use")
+    parser.add_argument("--flags", default="-std=c++20 -O1", help="compiler flags")
+    parser.add_argument("--tests", nargs="*", help="tests to compile, all of them by default")
+    parser.add_argument("--json", help="also write the results to this file")
+    args = parser.parse_args()
+
+    flags = [*args.flags.split(), "-I", os.path.join(ROOT, "include"),
+             "-I", os.path.join(ROOT, "support")]
+    sources = sorted(glob.glob(os.path.join(ROOT, "tests", "*", "*.cpp")))
+    if args.tests:
+        sources = [source for source in sources
+                   if os.path.basename(os.path.dirname(source)) in args.tests]
+
+    results = []
+    with tempfile.TemporaryDirectory() as directory:
+        module_seconds, import_flags = build_module(args, flags, directory)
+
+        for source in sources:
+            name = os.path.basename(os.path.dirname(source))
+            with open(source, encoding="utf-8") as file:
+                content = file.read()
+            if not INCLUDE_PATTERN.search(content):
+                continue
+
+            header_seconds, _ = run_compiler(
+                [args.cxx, *flags, "-c", source, "-o", os.path.join(directory, name + ".o")])
+
+            imported = os.path.join(directory, name + "_import.cpp")
+            with open(imported, "w", encoding="utf-8") as file:
+                file.write(to_import(content))
+            import_seconds, _ = run_compiler(
+                [args.cxx, *flags, *import_flags, "-c", imported,
+                 "-o", os.path.join(directory, name + "_import.o")], cwd=directory)
+
+            results.append({"test": name, "header_seconds": header_seconds,
+                            "import_seconds": import_seconds})
+
+    header_total = sum(result["header_seconds"] for result in results)
+    import_total = sum(result["import_seconds"] for result in results) + module_seconds
+
+    print(f"{'Test':<20} {'Header':>9} {'Import':>9}")
+    for result in results:
+        print(f"{result['test']:<20} {result['header_seconds']:>8.2f}s "
+              f"{result['import_seconds']:>8.2f}s")
+    print(f"{'module interface':<20} {'':>9} {module_seconds:>8.2f}s")
+    print(f"{'total':<20} {header_total:>8.2f}s {import_total:>8.2f}s")
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as file:
+            json.dump({"cxx": args.cxx, "flags": args.flags, "module_seconds": module_seconds,
+                       "header_seconds": header_total, "import_seconds": import_total,
+                       "results": results}, file, indent=2)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
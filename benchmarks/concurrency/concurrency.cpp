@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <memory>
+
+struct Config
+{
+    int value = 1;
+};
+
+struct Logger
+{
+    int level = 3;
+};
+
+struct Session
+{
+    Session(const Config& config, std::shared_ptr<Logger> logger)
+        : value(config.value)
+        , logger(std::move(logger))
+    {
+    }
+
+    int value;
+    std::shared_ptr<Logger> logger;
+};
+
+using ConfigService = dipp::injected<Config, dipp::service_lifetime::singleton>;
+using LoggerService = dipp::injected_shared<Logger, dipp::service_lifetime::singleton>;
+using SessionService = dipp::injected<Session,
+                                      dipp::service_lifetime::scoped,
+                                      dipp::dependency<ConfigService, LoggerService>>;
+
+// Shared by all benchmark threads. Resolutions only read the provider once the singletons exist,
+// so they are all built before any thread starts.
+static dipp::service_provider& shared_provider()
+{
+    static dipp::service_provider services = []
+    {
+        dipp::service_collection collection;
+
+        collection.add<ConfigService>();
+        collection.add<LoggerService>();
+        collection.add<SessionService>();
+
+        dipp::service_provider services(std::move(collection));
+        benchmark::DoNotOptimize(services.get<ConfigService>());
+        benchmark::DoNotOptimize(services.get<LoggerService>());
+        return services;
+    }();
+    return services;
+}
+
+// Dipp Benchmarks
+
+static void BM_DippConcurrentSingleton(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto config = services.get<ConfigService>();
+        benchmark::DoNotOptimize(config);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DippConcurrentSingleton)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_DippConcurrentSharedCopy(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    // every copy touches the one control block shared by all threads
+    for (auto _ : state)
+    {
+        std::shared_ptr<Logger> logger = *services.get<LoggerService>();
+        benchmark::DoNotOptimize(logger);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DippConcurrentSharedCopy)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_DippConcurrentScopes(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    // a scope per request on every thread, as a thread pool serving requests would
+    for (auto _ : state)
+    {
+        auto scope = services.create_scope();
+        auto session = scope.get<SessionService>();
+        benchmark::DoNotOptimize(session);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DippConcurrentScopes)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
\ No newline at end of file
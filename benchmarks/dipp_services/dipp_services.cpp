@@ -0,0 +1,313 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The basic_services scenario without the comparison libraries, extended with the request
+// lifecycle of a typical application.
+
+struct ILogger
+{
+    virtual ~ILogger() = default;
+    virtual void log(const std::string& message) = 0;
+};
+
+struct IDatabase
+{
+    virtual ~IDatabase() = default;
+    virtual void query(const std::string& sql) = 0;
+};
+
+struct IUserService
+{
+    virtual ~IUserService() = default;
+    virtual void createUser(const std::string& username) = 0;
+};
+
+class ConsoleLogger : public ILogger
+{
+public:
+    void log(const std::string& message) override
+    {
+        benchmark::DoNotOptimize(message);
+    }
+};
+
+class SQLDatabase : public IDatabase
+{
+public:
+    void query(const std::string& sql) override
+    {
+        benchmark::DoNotOptimize(sql);
+    }
+};
+
+class UserService : public IUserService
+{
+    std::shared_ptr<ILogger> logger_;
+    std::shared_ptr<IDatabase> database_;
+
+public:
+    UserService(std::shared_ptr<ILogger> logger, std::shared_ptr<IDatabase> database)
+        : logger_(std::move(logger))
+        , database_(std::move(database))
+    {
+    }
+
+    void createUser(const std::string& username) override
+    {
+        logger_->log(username);
+        database_->query(username);
+    }
+};
+
+// A unit of work per request, and a handler built for every message
+struct UnitOfWork
+{
+    explicit UnitOfWork(std::shared_ptr<IDatabase> database)
+        : database(std::move(database))
+    {
+    }
+
+    std::shared_ptr<IDatabase> database;
+    int pending = 0;
+};
+
+struct RequestHandler
+{
+    RequestHandler(IUserService& users, UnitOfWork& work)
+        : users(users)
+        , work(work)
+    {
+    }
+
+    IUserService& users;
+    UnitOfWork& work;
+};
+
+// Plugins registered several times under the same service
+struct Plugin
+{
+    int weight = 1;
+};
+
+// Built for every event, with every plugin injected
+struct PluginHost
+{
+    using plugin_list = std::vector<dipp::injected<Plugin, dipp::service_lifetime::singleton>>;
+
+    explicit PluginHost(plugin_list plugins)
+        : plugins(std::move(plugins))
+    {
+    }
+
+    plugin_list plugins;
+};
+
+using LoggerService = dipp::injected_shared<ILogger, dipp::service_lifetime::singleton>;
+using DatabaseService = dipp::injected_shared<IDatabase, dipp::service_lifetime::singleton>;
+using UserServiceService =
+    dipp::injected_shared<IUserService,
+                          dipp::service_lifetime::singleton,
+                          dipp::dependency<LoggerService, DatabaseService>>;
+using UserServiceRefService =
+    dipp::injected_shared_ref<IUserService,
+                              dipp::service_lifetime::singleton,
+                              dipp::dependency<LoggerService, DatabaseService>>;
+using UnitOfWorkService =
+    dipp::injected<UnitOfWork, dipp::service_lifetime::scoped, dipp::dependency<DatabaseService>>;
+using RequestHandlerService =
+    dipp::injected<RequestHandler,
+                   dipp::service_lifetime::transient,
+                   dipp::dependency<UserServiceRefService, UnitOfWorkService>>;
+using AuditLoggerService = dipp::
+    injected_shared<ILogger, dipp::service_lifetime::singleton, dipp::dependency<>, dipp::key("audit")>;
+using PluginService = dipp::injected<Plugin, dipp::service_lifetime::singleton>;
+using PluginHostService = dipp::injected<PluginHost,
+                                         dipp::service_lifetime::transient,
+                                         dipp::dependency<dipp::all_of<PluginService>>>;
+using PluginHostFactoryService = dipp::injected<PluginHost,
+                                                dipp::service_lifetime::transient,
+                                                dipp::dependency<>,
+                                                dipp::key("factory")>;
+
+static constexpr size_t plugin_count = 8;
+
+static dipp::service_collection make_collection()
+{
+    dipp::service_collection collection;
+
+    collection.add_impl<LoggerService, ConsoleLogger>();
+    collection.add_impl<DatabaseService, SQLDatabase>();
+    collection.add_impl<UserServiceService, UserService>();
+    collection.add<UnitOfWorkService>();
+    collection.add<RequestHandlerService>();
+    collection.add_impl<AuditLoggerService, ConsoleLogger>();
+    for (size_t i = 0; i < plugin_count; i++)
+    {
+        collection.add<PluginService>();
+    }
+
+    return collection;
+}
+
+// Resolves every singleton once, as an application would during startup
+static dipp::service_provider make_warm_provider(bool validate)
+{
+    dipp::service_provider services(make_collection());
+    if (validate)
+    {
+        (void) services.validate();
+    }
+
+    benchmark::DoNotOptimize(services.get<UserServiceService>());
+    benchmark::DoNotOptimize(services.get<AuditLoggerService>());
+    services.find_all<PluginService>([](dipp::service_getter<PluginService> getter)
+                                     { benchmark::DoNotOptimize(getter()); });
+    return services;
+}
+
+// Dipp Benchmarks
+
+static void BM_DippContainerCreation(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        dipp::service_provider services(make_collection());
+        benchmark::DoNotOptimize(services);
+    }
+}
+BENCHMARK(BM_DippContainerCreation);
+
+static void BM_DippStartup(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto services = make_warm_provider(false);
+        benchmark::DoNotOptimize(services);
+    }
+}
+BENCHMARK(BM_DippStartup);
+
+static void BM_DippResolution(benchmark::State& state)
+{
+    auto services = make_warm_provider(false);
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<UserServiceService>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippResolution);
+
+static void BM_DippKeyedResolution(benchmark::State& state)
+{
+    auto services = make_warm_provider(false);
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<AuditLoggerService>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippKeyedResolution);
+
+static void BM_DippPlugins(benchmark::State& state)
+{
+    auto services = make_warm_provider(false);
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        int weight = 0;
+        services.find_all<PluginService>(
+            [&weight](dipp::service_getter<PluginService> getter)
+            {
+                const Plugin& plugin = *getter();
+                weight += plugin.weight;
+            });
+        benchmark::DoNotOptimize(weight);
+    }
+}
+BENCHMARK(BM_DippPlugins);
+
+static void BM_DippPluginsGetAll(benchmark::State& state)
+{
+    auto services = make_warm_provider(false);
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        int weight = 0;
+        for (const Plugin& plugin : *services.get_all<PluginService>())
+        {
+            weight += plugin.weight;
+        }
+        benchmark::DoNotOptimize(weight);
+    }
+}
+BENCHMARK(BM_DippPluginsGetAll);
+
+static void BM_DippPluginHostFindAll(benchmark::State& state)
+{
+    auto collection = make_collection();
+    collection.add<PluginHostFactoryService>(
+        [](dipp::service_scope& scope)
+        {
+            std::vector<PluginService> plugins;
+            scope.find_all<PluginService>([&plugins](dipp::service_getter<PluginService> getter)
+                                          { plugins.emplace_back(*getter()); });
+            return PluginHost(std::move(plugins));
+        });
+    dipp::service_provider services(std::move(collection));
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto host = services.get<PluginHostFactoryService>();
+        benchmark::DoNotOptimize(host);
+    }
+}
+BENCHMARK(BM_DippPluginHostFindAll);
+
+static void BM_DippPluginHostAllOf(benchmark::State& state)
+{
+    auto collection = make_collection();
+    collection.add<PluginHostService>();
+    dipp::service_provider services(std::move(collection));
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto host = services.get<PluginHostService>();
+        benchmark::DoNotOptimize(host);
+    }
+}
+BENCHMARK(BM_DippPluginHostAllOf);
+
+static void BM_DippRequest(benchmark::State& state)
+{
+    auto services = make_warm_provider(state.range(0) != 0);
+
+    // a scope per request, handling a few messages
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto scope = services.create_scope();
+        for (int i = 0; i < 4; i++)
+        {
+            auto handler = scope.get<RequestHandlerService>();
+            benchmark::DoNotOptimize(handler);
+        }
+    }
+}
+BENCHMARK(BM_DippRequest)->ArgName("validated")->Arg(0)->Arg(1);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <utility>
+
+static constexpr size_t graph_depth = 50;
+static constexpr size_t graph_width = 50;
+
+// A chain of services, each one depending on the previous one. The chains of each lifetime are
+// registered under their own key.
+template<size_t Depth>
+struct Chain
+{
+    explicit Chain(const Chain<Depth - 1>& next)
+        : value(next.value + 1)
+    {
+    }
+
+    int value;
+};
+
+template<>
+struct Chain<0>
+{
+    int value = 0;
+};
+
+template<size_t Depth, dipp::service_lifetime Lifetime>
+struct chain_service
+{
+    using type = dipp::injected<Chain<Depth>,
+                                Lifetime,
+                                dipp::dependency<typename chain_service<Depth - 1, Lifetime>::type>,
+                                static_cast<size_t>(Lifetime)>;
+};
+
+template<dipp::service_lifetime Lifetime>
+struct chain_service<0, Lifetime>
+{
+    using type =
+        dipp::injected<Chain<0>, Lifetime, dipp::dependency<>, static_cast<size_t>(Lifetime)>;
+};
+
+template<size_t Depth, dipp::service_lifetime Lifetime>
+using ChainService = typename chain_service<Depth, Lifetime>::type;
+
+// A service depending on every leaf at once
+template<size_t Index>
+struct Leaf
+{
+    int value = 1;
+};
+
+template<size_t Index>
+using LeafService = dipp::injected<Leaf<Index>, dipp::service_lifetime::singleton>;
+
+struct Wide
+{
+    template<typename... LeavesTy>
+        requires(sizeof...(LeavesTy) > 1)
+    explicit Wide(LeavesTy&&... leaves)
+        : sum((leaves->value + ...))
+    {
+    }
+
+    int sum;
+};
+
+template<typename>
+struct wide_service;
+
+template<size_t... Is>
+struct wide_service<std::index_sequence<Is...>>
+{
+    using type = dipp::injected<Wide,
+                                dipp::service_lifetime::transient,
+                                dipp::dependency<LeafService<Is>...>>;
+};
+
+using WideService = typename wide_service<std::make_index_sequence<graph_width>>::type;
+
+template<dipp::service_lifetime Lifetime, size_t... Is>
+static void add_chain(dipp::service_collection& collection, std::index_sequence<Is...>)
+{
+    (collection.add<ChainService<Is, Lifetime>>(), ...);
+}
+
+template<size_t... Is>
+static void add_leaves(dipp::service_collection& collection, std::index_sequence<Is...>)
+{
+    (collection.add<LeafService<Is>>(), ...);
+}
+
+static dipp::service_provider setup()
+{
+    dipp::service_collection collection;
+
+    add_chain<dipp::service_lifetime::singleton>(collection,
+                                                 std::make_index_sequence<graph_depth + 1>());
+    add_chain<dipp::service_lifetime::scoped>(collection,
+                                              std::make_index_sequence<graph_depth + 1>());
+    add_chain<dipp::service_lifetime::transient>(collection,
+                                                 std::make_index_sequence<graph_depth + 1>());
+    add_leaves(collection, std::make_index_sequence<graph_width>());
+    collection.add<WideService>();
+
+    return dipp::service_provider(std::move(collection));
+}
+
+// Dipp Benchmarks
+
+static void BM_DippDeepTransient(benchmark::State& state)
+{
+    auto services = setup();
+
+    dipp::support::benchmark_allocations allocations(state);
+    // every resolution rebuilds the whole chain
+    for (auto _ : state)
+    {
+        auto service = services.get<ChainService<graph_depth, dipp::service_lifetime::transient>>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippDeepTransient);
+
+static void BM_DippDeepScoped(benchmark::State& state)
+{
+    auto services = setup();
+
+    dipp::support::benchmark_allocations allocations(state);
+    // every scope builds the chain once
+    for (auto _ : state)
+    {
+        auto scope = services.create_scope();
+        auto service = scope.get<ChainService<graph_depth, dipp::service_lifetime::scoped>>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippDeepScoped);
+
+static void BM_DippDeepSingleton(benchmark::State& state)
+{
+    auto services = setup();
+    benchmark::DoNotOptimize(
+        services.get<ChainService<graph_depth, dipp::service_lifetime::singleton>>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<ChainService<graph_depth, dipp::service_lifetime::singleton>>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippDeepSingleton);
+
+static void BM_DippWideTransient(benchmark::State& state)
+{
+    auto services = setup();
+
+    // warm up the leaves so only the fan-out is measured
+    benchmark::DoNotOptimize(services.get<WideService>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<WideService>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippWideTransient);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+
+struct Connection
+{
+    int value = 1;
+};
+
+template<size_t Key>
+using ConnectionService =
+    dipp::injected<Connection, dipp::service_lifetime::singleton, dipp::dependency<>, Key>;
+
+using PrimaryService = ConnectionService<dipp::key("primary")>;
+using ReplicaService = ConnectionService<dipp::key("replica")>;
+
+struct Handler
+{
+    int value = 1;
+};
+
+using HandlerService = dipp::injected<Handler, dipp::service_lifetime::singleton>;
+
+// Registers the looked up keys among state.range(0) other keyed registrations of the same type
+static dipp::service_provider setup_keyed(size_t filler_count)
+{
+    dipp::service_collection collection;
+
+    for (size_t i = 0; i < filler_count; i++)
+    {
+        collection.add(ConnectionService<0>::descriptor_type::factory(), i + 1);
+    }
+    collection.add<PrimaryService>();
+    collection.add<ReplicaService>();
+
+    return dipp::service_provider(std::move(collection));
+}
+
+// Registers state.range(0) implementations of the same service
+static dipp::service_provider setup_handlers(size_t count)
+{
+    dipp::service_collection collection;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        collection.add<HandlerService>();
+    }
+
+    return dipp::service_provider(std::move(collection));
+}
+
+// Dipp Benchmarks
+
+static void BM_DippKeyedLookup(benchmark::State& state)
+{
+    auto services = setup_keyed(state.range(0));
+    benchmark::DoNotOptimize(services.get<PrimaryService>());
+    benchmark::DoNotOptimize(services.get<ReplicaService>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto primary = services.get<PrimaryService>();
+        auto replica = services.get<ReplicaService>();
+        benchmark::DoNotOptimize(primary);
+        benchmark::DoNotOptimize(replica);
+    }
+}
+BENCHMARK(BM_DippKeyedLookup)->RangeMultiplier(8)->Range(1, 4096);
+
+// Routes state.range(0) requests to tenant singletons registered with runtime keys
+static void BM_DippRuntimeKeyLookup(benchmark::State& state)
+{
+    auto services = setup_keyed(state.range(0));
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        for (size_t tenant = 1; tenant <= static_cast<size_t>(state.range(0)); tenant++)
+        {
+            auto connection = services.get<ConnectionService<0>>(tenant);
+            benchmark::DoNotOptimize(connection);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DippRuntimeKeyLookup)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_DippDenseIndexLookup(benchmark::State& state)
+{
+    auto services = setup_keyed(state.range(0));
+    dipp::dense_service_index<ConnectionService<0>> tenants(services.root_scope(),
+                                                            state.range(0) + 1);
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        for (size_t tenant = 1; tenant <= static_cast<size_t>(state.range(0)); tenant++)
+        {
+            auto connection = tenants.get(tenant);
+            benchmark::DoNotOptimize(connection);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DippDenseIndexLookup)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_DippFindAll(benchmark::State& state)
+{
+    auto services = setup_handlers(state.range(0));
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        int sum = 0;
+        services.find_all<HandlerService>(
+            [&sum](dipp::service_getter<HandlerService> getter)
+            {
+                const Handler& handler = *getter();
+                sum += handler.value;
+            });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DippFindAll)->RangeMultiplier(8)->Range(1, 512);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <utility>
+#include <vector>
+
+struct Filler
+{
+    int value = 1;
+};
+
+struct Target
+{
+    int value = 1;
+};
+
+using FillerService = dipp::injected<Filler, dipp::service_lifetime::singleton>;
+using TargetService = dipp::injected<Target, dipp::service_lifetime::singleton>;
+using TransientTargetService =
+    dipp::injected<Target, dipp::service_lifetime::transient, dipp::dependency<>, 1>;
+
+// Generates count registrations, as distinct handles through runtime keys, around the two targets.
+// Generating that many distinct types would only measure the compiler.
+static dipp::service_collection make_collection(size_t count)
+{
+    dipp::service_collection collection;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        collection.add(FillerService::descriptor_type::factory(), i);
+    }
+    collection.add<TargetService>();
+    collection.add<TransientTargetService>();
+
+    return collection;
+}
+
+// The same registrations, with the fillers added in bulk
+static dipp::service_collection make_bulk_collection(size_t count)
+{
+    dipp::service_collection collection;
+    collection.reserve(count + 2);
+
+    std::vector<std::pair<FillerService::descriptor_type, size_t>> fillers;
+    fillers.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        fillers.emplace_back(FillerService::descriptor_type::factory(), i);
+    }
+    collection.add_range(std::move(fillers));
+    collection.add<TargetService>();
+    collection.add<TransientTargetService>();
+
+    return collection;
+}
+
+// Dipp Benchmarks
+
+static void BM_DippRegistryBuild(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        dipp::service_provider services(make_collection(state.range(0)));
+        benchmark::DoNotOptimize(services);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DippRegistryBuild)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_DippRegistryBulkBuild(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        dipp::service_provider services(make_bulk_collection(state.range(0)));
+        benchmark::DoNotOptimize(services);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DippRegistryBulkBuild)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_DippRegistrySingleton(benchmark::State& state)
+{
+    dipp::service_provider services(make_collection(state.range(0)));
+    benchmark::DoNotOptimize(services.get<TargetService>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<TargetService>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippRegistrySingleton)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_DippRegistryTransient(benchmark::State& state)
+{
+    dipp::service_provider services(make_collection(state.range(0)));
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<TransientTargetService>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippRegistryTransient)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_DippRegistryCountAll(benchmark::State& state)
+{
+    dipp::service_provider services(make_collection(state.range(0)));
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto count = services.count_all<TargetService>();
+        benchmark::DoNotOptimize(count);
+    }
+}
+BENCHMARK(BM_DippRegistryCountAll)->Arg(100)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
\ No newline at end of file
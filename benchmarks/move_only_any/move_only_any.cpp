@@ -0,0 +1,182 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+
+using dipp::details::move_only_any;
+
+// Payloads around the 32 byte small buffer, trivially movable ones use the trivial storage while
+// the others need the small storage's move and destroy callbacks, anything larger is heap allocated
+template<size_t Size>
+struct Trivial
+{
+    std::array<std::byte, Size> bytes{};
+};
+
+template<size_t Size>
+struct NonTrivial
+{
+    NonTrivial() = default;
+
+    NonTrivial(NonTrivial&& other) noexcept
+        : bytes(other.bytes)
+    {
+        benchmark::ClobberMemory();
+    }
+
+    NonTrivial& operator=(NonTrivial&& other) noexcept
+    {
+        bytes = other.bytes;
+        benchmark::ClobberMemory();
+        return *this;
+    }
+
+    ~NonTrivial()
+    {
+        benchmark::ClobberMemory();
+    }
+
+    std::array<std::byte, Size> bytes{};
+};
+
+template<typename Ty>
+static void set_storage_label(benchmark::State& state)
+{
+    move_only_any any = move_only_any::make<Ty>();
+    if (any.is_heap_allocated())
+    {
+        state.SetLabel("large");
+    }
+    else if (std::is_trivially_move_constructible_v<Ty>)
+    {
+        state.SetLabel("trivial");
+    }
+    else
+    {
+        state.SetLabel("small");
+    }
+}
+
+static constexpr size_t batch_size = 1024;
+
+// Benchmarks
+
+template<typename Ty>
+static void BM_AnyMake(benchmark::State& state)
+{
+    set_storage_label<Ty>(state);
+
+    // includes the destruction of the made value
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        move_only_any any = move_only_any::make<Ty>();
+        benchmark::DoNotOptimize(any);
+    }
+}
+
+template<typename Ty>
+static void BM_AnyMoveConstruct(benchmark::State& state)
+{
+    set_storage_label<Ty>(state);
+
+    alignas(move_only_any) std::byte first[sizeof(move_only_any)];
+    alignas(move_only_any) std::byte second[sizeof(move_only_any)];
+    auto source =
+        std::construct_at(reinterpret_cast<move_only_any*>(first), move_only_any::make<Ty>());
+    auto target = reinterpret_cast<move_only_any*>(second);
+
+    // moves the value back and forth, destroying the emptied any each time
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        std::construct_at(target, std::move(*source));
+        std::destroy_at(source);
+        std::swap(source, target);
+        benchmark::DoNotOptimize(source);
+    }
+
+    std::destroy_at(source);
+}
+
+template<typename Ty>
+static void BM_AnyMoveAssign(benchmark::State& state)
+{
+    set_storage_label<Ty>(state);
+
+    auto first = move_only_any::make<Ty>();
+    auto second = move_only_any::make<Ty>();
+
+    // the assigned any is always empty but the first time, as assignment leaves the source empty
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        second = std::move(first);
+        first = std::move(second);
+        benchmark::DoNotOptimize(first);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+template<typename Ty>
+static void BM_AnyCast(benchmark::State& state)
+{
+    set_storage_label<Ty>(state);
+
+    move_only_any any = move_only_any::make<Ty>();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(any);
+        auto value = any.cast<Ty>();
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+template<typename Ty>
+static void BM_AnyDestroy(benchmark::State& state)
+{
+    set_storage_label<Ty>(state);
+
+    std::vector<move_only_any> values;
+    values.reserve(batch_size);
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        allocations.pause();
+        for (size_t i = 0; i < batch_size; i++)
+        {
+            values.emplace_back(move_only_any::make<Ty>());
+        }
+        allocations.resume();
+        state.ResumeTiming();
+
+        values.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * batch_size);
+}
+
+#define DIPP_BENCHMARK_ANY(Benchmark)                                                              \
+    BENCHMARK_TEMPLATE(Benchmark, Trivial<8>);                                                     \
+    BENCHMARK_TEMPLATE(Benchmark, Trivial<24>);                                                    \
+    BENCHMARK_TEMPLATE(Benchmark, Trivial<32>);                                                    \
+    BENCHMARK_TEMPLATE(Benchmark, Trivial<40>);                                                    \
+    BENCHMARK_TEMPLATE(Benchmark, Trivial<64>);                                                    \
+    BENCHMARK_TEMPLATE(Benchmark, NonTrivial<8>);                                                  \
+    BENCHMARK_TEMPLATE(Benchmark, NonTrivial<24>);                                                 \
+    BENCHMARK_TEMPLATE(Benchmark, NonTrivial<32>);                                                 \
+    BENCHMARK_TEMPLATE(Benchmark, NonTrivial<40>);                                                 \
+    BENCHMARK_TEMPLATE(Benchmark, NonTrivial<64>)
+
+DIPP_BENCHMARK_ANY(BM_AnyMake);
+DIPP_BENCHMARK_ANY(BM_AnyMoveConstruct);
+DIPP_BENCHMARK_ANY(BM_AnyMoveAssign);
+DIPP_BENCHMARK_ANY(BM_AnyCast);
+DIPP_BENCHMARK_ANY(BM_AnyDestroy);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+
+struct Config
+{
+    int value = 1;
+};
+
+struct Session
+{
+    explicit Session(const Config& config)
+        : value(config.value)
+    {
+    }
+
+    int value;
+};
+
+struct Request
+{
+    explicit Request(const Session& session)
+        : value(session.value)
+    {
+    }
+
+    int value;
+};
+
+using ConfigService = dipp::injected<Config, dipp::service_lifetime::singleton>;
+using SessionService =
+    dipp::injected<Session, dipp::service_lifetime::scoped, dipp::dependency<ConfigService>>;
+using RequestService =
+    dipp::injected<Request, dipp::service_lifetime::scoped, dipp::dependency<SessionService>>;
+
+static dipp::service_provider setup()
+{
+    dipp::service_collection collection;
+
+    collection.add<ConfigService>();
+    collection.add<SessionService>();
+    collection.add<RequestService>();
+
+    return dipp::service_provider(std::move(collection));
+}
+
+// Dipp Benchmarks
+
+static void BM_DippScopeCreation(benchmark::State& state)
+{
+    auto services = setup();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto scope = services.create_scope();
+        benchmark::DoNotOptimize(scope);
+    }
+}
+BENCHMARK(BM_DippScopeCreation);
+
+static void BM_DippScopeWithResolution(benchmark::State& state)
+{
+    auto services = setup();
+    benchmark::DoNotOptimize(services.get<ConfigService>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    // a scope per request, constructing then destroying its scoped services
+    for (auto _ : state)
+    {
+        auto scope = services.create_scope();
+        auto request = scope.get<RequestService>();
+        benchmark::DoNotOptimize(request);
+    }
+}
+BENCHMARK(BM_DippScopeWithResolution);
+
+static void BM_DippScopedResolution(benchmark::State& state)
+{
+    auto services = setup();
+    auto scope = services.create_scope();
+    benchmark::DoNotOptimize(scope.get<RequestService>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    // only cache hits, the scoped services are already built
+    for (auto _ : state)
+    {
+        auto request = scope.get<RequestService>();
+        benchmark::DoNotOptimize(request);
+    }
+}
+BENCHMARK(BM_DippScopedResolution);
+
+BENCHMARK_MAIN();
\ No newline at end of file
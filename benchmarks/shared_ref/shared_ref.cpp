@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <memory>
+
+struct Logger
+{
+    int level = 3;
+};
+
+using LoggerService = dipp::injected_shared<Logger, dipp::service_lifetime::singleton>;
+using LoggerRefService = dipp::injected_shared_ref<Logger, dipp::service_lifetime::singleton>;
+
+// Consumers built on every resolution, one owning and one borrowing the logger
+struct OwningHandler
+{
+    explicit OwningHandler(std::shared_ptr<Logger> logger)
+        : logger(std::move(logger))
+    {
+    }
+
+    std::shared_ptr<Logger> logger;
+};
+
+struct BorrowingHandler
+{
+    explicit BorrowingHandler(Logger& logger)
+        : logger(logger)
+    {
+    }
+
+    Logger& logger;
+};
+
+using OwningHandlerService = dipp::
+    injected<OwningHandler, dipp::service_lifetime::transient, dipp::dependency<LoggerService>>;
+using BorrowingHandlerService = dipp::injected<BorrowingHandler,
+                                               dipp::service_lifetime::transient,
+                                               dipp::dependency<LoggerRefService>>;
+
+// Shared by all benchmark threads, the singleton is built before any thread starts resolving
+static dipp::service_provider& shared_provider()
+{
+    static dipp::service_provider services = []
+    {
+        dipp::service_collection collection;
+
+        collection.add<LoggerService>();
+        collection.add<OwningHandlerService>();
+        collection.add<BorrowingHandlerService>();
+
+        dipp::service_provider services(std::move(collection));
+        benchmark::DoNotOptimize(services.get<LoggerService>());
+        return services;
+    }();
+    return services;
+}
+
+// Dipp Benchmarks
+
+static void BM_DippSharedCopy(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        std::shared_ptr<Logger> logger = *services.get<LoggerService>();
+        benchmark::DoNotOptimize(logger);
+    }
+}
+BENCHMARK(BM_DippSharedCopy)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_DippSharedBorrow(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        LoggerRefService logger = *services.get<LoggerRefService>();
+        benchmark::DoNotOptimize(logger.ptr());
+    }
+}
+BENCHMARK(BM_DippSharedBorrow)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_DippOwningConsumer(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto handler = services.get<OwningHandlerService>();
+        benchmark::DoNotOptimize(handler);
+    }
+}
+BENCHMARK(BM_DippOwningConsumer)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_DippBorrowingConsumer(benchmark::State& state)
+{
+    auto& services = shared_provider();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto handler = services.get<BorrowingHandlerService>();
+        benchmark::DoNotOptimize(handler);
+    }
+}
+BENCHMARK(BM_DippBorrowingConsumer)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
\ No newline at end of file
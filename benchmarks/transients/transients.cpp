@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <array>
+#include <memory>
+
+// Fits in move_only_any's trivial buffer
+struct SmallService
+{
+    int value = 1;
+};
+
+// Larger than move_only_any's 32 byte small buffer
+struct LargeService
+{
+    std::array<int, 16> values{};
+};
+
+// Cannot be copied, only moved out of the container
+struct MoveOnlyService
+{
+    MoveOnlyService()
+        : value(std::make_unique<int>(1))
+    {
+    }
+
+    MoveOnlyService(const MoveOnlyService&) = delete;
+    MoveOnlyService& operator=(const MoveOnlyService&) = delete;
+    MoveOnlyService(MoveOnlyService&&) = default;
+    MoveOnlyService& operator=(MoveOnlyService&&) = default;
+
+    std::unique_ptr<int> value;
+};
+
+using SmallTransientService = dipp::injected<SmallService, dipp::service_lifetime::transient>;
+using LargeTransientService = dipp::injected<LargeService, dipp::service_lifetime::transient>;
+using MoveOnlyTransientService =
+    dipp::injected<MoveOnlyService, dipp::service_lifetime::transient>;
+using UniqueTransientService =
+    dipp::injected_unique<SmallService, dipp::service_lifetime::transient>;
+
+static dipp::service_provider setup()
+{
+    dipp::service_collection collection;
+
+    collection.add<SmallTransientService>();
+    collection.add<LargeTransientService>();
+    collection.add<MoveOnlyTransientService>();
+    collection.add<UniqueTransientService>();
+
+    return dipp::service_provider(std::move(collection));
+}
+
+// Dipp Benchmarks
+
+template<typename ServiceTy>
+static void BM_DippTransient(benchmark::State& state)
+{
+    auto services = setup();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<ServiceTy>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippTransient<SmallTransientService>)->Name("BM_DippTransientSmall");
+BENCHMARK(BM_DippTransient<LargeTransientService>)->Name("BM_DippTransientLarge");
+BENCHMARK(BM_DippTransient<MoveOnlyTransientService>)->Name("BM_DippTransientMoveOnly");
+BENCHMARK(BM_DippTransient<UniqueTransientService>)->Name("BM_DippTransientUnique");
+
+// Manual Benchmarks
+
+static void BM_ManualTransientLarge(benchmark::State& state)
+{
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        LargeService service;
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_ManualTransientLarge);
+
+BENCHMARK_MAIN();
\ No newline at end of file
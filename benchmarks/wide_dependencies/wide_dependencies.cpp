@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_allocations.hpp>
+#include <dipp/dipp.hpp>
+#include <memory>
+
+// Ten independent singleton dependencies, each handed out as a shared_ptr
+template<int Index>
+struct Dependency
+{
+    int value = Index;
+};
+
+template<int Index>
+using DependencyService =
+    dipp::injected_shared<Dependency<Index>, dipp::service_lifetime::singleton>;
+
+// A service with a wide constructor, rebuilt on every resolution
+struct WideService
+{
+    WideService(std::shared_ptr<Dependency<0>> d0,
+                std::shared_ptr<Dependency<1>> d1,
+                std::shared_ptr<Dependency<2>> d2,
+                std::shared_ptr<Dependency<3>> d3,
+                std::shared_ptr<Dependency<4>> d4,
+                std::shared_ptr<Dependency<5>> d5,
+                std::shared_ptr<Dependency<6>> d6,
+                std::shared_ptr<Dependency<7>> d7,
+                std::shared_ptr<Dependency<8>> d8,
+                std::shared_ptr<Dependency<9>> d9)
+        : sum(d0->value + d1->value + d2->value + d3->value + d4->value + d5->value + d6->value +
+              d7->value + d8->value + d9->value)
+    {
+    }
+
+    int sum;
+};
+
+using WideTransientService = dipp::injected_unique<WideService,
+                                                   dipp::service_lifetime::transient,
+                                                   dipp::dependency<DependencyService<0>,
+                                                                    DependencyService<1>,
+                                                                    DependencyService<2>,
+                                                                    DependencyService<3>,
+                                                                    DependencyService<4>,
+                                                                    DependencyService<5>,
+                                                                    DependencyService<6>,
+                                                                    DependencyService<7>,
+                                                                    DependencyService<8>,
+                                                                    DependencyService<9>>>;
+
+static dipp::service_provider setup()
+{
+    dipp::service_collection collection;
+
+    collection.add<DependencyService<0>>();
+    collection.add<DependencyService<1>>();
+    collection.add<DependencyService<2>>();
+    collection.add<DependencyService<3>>();
+    collection.add<DependencyService<4>>();
+    collection.add<DependencyService<5>>();
+    collection.add<DependencyService<6>>();
+    collection.add<DependencyService<7>>();
+    collection.add<DependencyService<8>>();
+    collection.add<DependencyService<9>>();
+    collection.add<WideTransientService>();
+
+    return dipp::service_provider(std::move(collection));
+}
+
+// Dipp Benchmarks
+
+static void BM_DippWideConstruction(benchmark::State& state)
+{
+    auto services = setup();
+
+    // warm up the singletons so only the wide construction is measured
+    benchmark::DoNotOptimize(services.get<WideTransientService>());
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = services.get<WideTransientService>();
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_DippWideConstruction);
+
+static void BM_ManualWideConstruction(benchmark::State& state)
+{
+    auto d0 = std::make_shared<Dependency<0>>();
+    auto d1 = std::make_shared<Dependency<1>>();
+    auto d2 = std::make_shared<Dependency<2>>();
+    auto d3 = std::make_shared<Dependency<3>>();
+    auto d4 = std::make_shared<Dependency<4>>();
+    auto d5 = std::make_shared<Dependency<5>>();
+    auto d6 = std::make_shared<Dependency<6>>();
+    auto d7 = std::make_shared<Dependency<7>>();
+    auto d8 = std::make_shared<Dependency<8>>();
+    auto d9 = std::make_shared<Dependency<9>>();
+
+    dipp::support::benchmark_allocations allocations(state);
+    for (auto _ : state)
+    {
+        auto service = std::make_unique<WideService>(d0, d1, d2, d3, d4, d5, d6, d7, d8, d9);
+        benchmark::DoNotOptimize(service);
+    }
+}
+BENCHMARK(BM_ManualWideConstruction);
+
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -1,57 +1,107 @@
 #pragma once
 
+#include <functional>
+#include <tuple>
 #include "concepts.hpp"
 #include "dependency.hpp"
 
 namespace dipp::details
 {
     /// <summary>
-    /// Applies a factory function to a tuple of dependencies and arguments.
+    /// Deduces the return type of a factory invoked with the resolved dependencies and arguments.
     /// </summary>
-    template<typename DepsTy, typename ScopeTy, typename FactoryTy, typename ArgsTy>
-    [[nodiscard]] static auto apply(ScopeTy& scope, FactoryTy&& factory, ArgsTy&& args)
+    template<typename FactoryTy,
+             typename DependenciesTy,
+             typename ArgsTy,
+             typename = std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<ArgsTy>>>>
+    struct apply_result;
+
+    template<typename FactoryTy, typename... DepsTy, typename ArgsTy, size_t... Is>
+    struct apply_result<FactoryTy, std::tuple<DepsTy...>, ArgsTy, std::index_sequence<Is...>>
     {
-        using dependencies_type = typename DepsTy::types;
-        using args_type = ArgsTy;
+        using type = std::invoke_result_t<FactoryTy,
+                                          DepsTy&&...,
+                                          decltype(std::get<Is>(std::declval<ArgsTy>()))...>;
+    };
+
+    template<typename FactoryTy, typename DependenciesTy, typename ArgsTy>
+    using apply_result_t = typename apply_result<FactoryTy, DependenciesTy, ArgsTy>::type;
 
-        if constexpr (std::tuple_size_v<dependencies_type> == 0)
+#ifdef DIPP_USE_RESULT
+    /// <summary>
+    /// Converts an error into the return type of a factory function.
+    /// </summary>
+    template<typename ReturnTy>
+    [[nodiscard]] auto make_error_return(error_id error) -> ReturnTy
+    {
+        if constexpr (std::same_as<ReturnTy, move_only_any>)
         {
-            return std::apply(std::forward<FactoryTy>(factory), std::forward<ArgsTy>(args));
+            return move_only_any::make_error(error);
         }
-        else if constexpr (std::tuple_size_v<args_type> == 0)
+        else
         {
-            auto dependencies = dipp::details::get_tuple_from_scope<DepsTy>(scope);
-
-            bool has_error = dipp::details::has_error_in_tuple<DepsTy>(dependencies);
-
-#ifdef DIPP_USE_RESULT
-            if (has_error)
-            {
-                return move_only_any::make_error(dipp::details::get_error_from_tuple<DepsTy>(dependencies));
-            }
+            return ReturnTy(error);
+        }
+    }
 #endif
 
-            return std::apply(std::forward<FactoryTy>(factory),
-                              dipp::details::unwrap_tuple_values<DepsTy>(std::move(dependencies)));
+    /// <summary>
+    /// Resolves the dependencies one at a time into locals, then invokes the factory with each
+    /// dependency moved exactly once followed by the forwarded arguments.
+    /// </summary>
+    template<typename ReturnTy,
+             typename DependenciesTy,
+             size_t Index,
+             typename ScopeTy,
+             typename FactoryTy,
+             typename ArgsTy,
+             typename... ResolvedTy>
+    [[nodiscard]] auto apply_impl(ScopeTy& scope,
+                                         FactoryTy&& factory,
+                                         ArgsTy&& args,
+                                         ResolvedTy&... resolved) -> ReturnTy
+    {
+        if constexpr (Index == std::tuple_size_v<DependenciesTy>)
+        {
+            return std::apply(
+                [&](auto&&... params) -> ReturnTy
+                {
+                    return std::invoke(std::forward<FactoryTy>(factory),
+                                       std::move(resolved.value())...,
+                                       std::forward<decltype(params)>(params)...);
+                },
+                std::forward<ArgsTy>(args));
         }
         else
         {
-            auto dependencies = dipp::details::get_tuple_from_scope<DepsTy>(scope);
-
-            bool has_error = dipp::details::has_error_in_tuple<DepsTy>(dependencies);
+            using dependency_type = std::tuple_element_t<Index, DependenciesTy>;
 
+            auto dependency = scope.template get<dependency_type>();
 #ifdef DIPP_USE_RESULT
-            if (has_error)
+            if (dependency.has_error()) [[unlikely]]
             {
-                return move_only_any::make_error(
-                    dipp::details::get_error_from_tuple<DepsTy>(dependencies));
+                return make_error_return<ReturnTy>(dependency.error());
             }
 #endif
 
-            return std::apply(
-                std::forward<FactoryTy>(factory),
-                std::tuple_cat(dipp::details::unwrap_tuple_values<DepsTy>(std::move(dependencies)),
-                               std::forward<ArgsTy>(args)));
+            return apply_impl<ReturnTy, DependenciesTy, Index + 1>(scope,
+                                                                   std::forward<FactoryTy>(factory),
+                                                                   std::forward<ArgsTy>(args),
+                                                                   resolved...,
+                                                                   dependency);
         }
     }
+
+    /// <summary>
+    /// Applies a factory function to a tuple of dependencies and arguments.
+    /// </summary>
+    template<typename DepsTy, typename ScopeTy, typename FactoryTy, typename ArgsTy>
+    [[nodiscard]] auto apply(ScopeTy& scope, FactoryTy&& factory, ArgsTy&& args)
+    {
+        using dependencies_type = typename DepsTy::types;
+        using return_type = apply_result_t<FactoryTy, dependencies_type, ArgsTy>;
+
+        return apply_impl<return_type, dependencies_type, 0>(
+            scope, std::forward<FactoryTy>(factory), std::forward<ArgsTy>(args));
+    }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "storage.hpp"
+#include "graph.hpp"
 
 namespace dipp::details
 {
@@ -92,6 +93,18 @@ namespace dipp::details
         template<base_injected_type InjectableTy, typename FactoryTy>
             requires std::invocable<FactoryTy, typename InjectableTy::descriptor_type::scope_type&>
         void add(FactoryTy&& factory)
+        {
+            add<InjectableTy>(std::forward<FactoryTy>(factory), InjectableTy::key);
+        }
+
+        /// <summary>
+        /// Adds a service to the collection using a custom factory function, with a key known at
+        /// runtime instead of the key of the injected type.
+        /// Example: collection.add<TenantDbService>([&](auto&) { return connect(id); }, id);
+        /// </summary>
+        template<base_injected_type InjectableTy, typename FactoryTy, std::integral KeyTy>
+            requires std::invocable<FactoryTy, typename InjectableTy::descriptor_type::scope_type&>
+        void add(FactoryTy&& factory, KeyTy key)
         {
             using descriptor_type = typename InjectableTy::descriptor_type;
             using value_type = typename descriptor_type::value_type;
@@ -102,7 +115,7 @@ namespace dipp::details
             // If return type is move_only_any, use directly
             if constexpr (std::same_as<return_type, move_only_any>)
             {
-                add(descriptor_type(std::forward<FactoryTy>(factory)), InjectableTy::key);
+                add(descriptor_type(std::forward<FactoryTy>(factory)), static_cast<size_t>(key));
             }
             // If actual return type can be converted to value_type, wrap it
             else if constexpr (convertible_to<actual_return_type, value_type>)
@@ -110,7 +123,7 @@ namespace dipp::details
                 auto wrapped_factory = [factory = std::forward<FactoryTy>(factory)](
                                            scope_type& scope) mutable -> move_only_any
                 { return dipp::details::make_any<value_type>(factory(scope)); };
-                add(descriptor_type(std::move(wrapped_factory)), InjectableTy::key);
+                add(descriptor_type(std::move(wrapped_factory)), static_cast<size_t>(key));
             }
             else
             {
@@ -150,6 +163,27 @@ namespace dipp::details
             m_Storage.add_service(std::forward<DescTy>(descriptor), key);
         }
 
+        /// <summary>
+        /// Adds services in bulk from a range of (descriptor, key) pairs of one descriptor type, as
+        /// if each pair was added in order. Large registries build faster: the descriptors share
+        /// one allocation and the registrations are sorted once before being inserted.
+        /// Example: std::vector<std::pair<TenantDbService::descriptor_type, size_t>> tenants;
+        ///          collection.add_range(std::move(tenants));
+        /// </summary>
+        template<service_registration_range_type RangeTy>
+        void add_range(RangeTy&& registrations)
+        {
+            m_Storage.add_services(std::forward<RangeTy>(registrations));
+        }
+
+        /// <summary>
+        /// Reserves room for the specified number of registrations.
+        /// </summary>
+        void reserve(size_t count)
+        {
+            m_Storage.reserve(count);
+        }
+
     public:
         /// <summary>
         /// Emplaces a service in the collection if it doesn't already exist.
@@ -303,6 +337,34 @@ namespace dipp::details
             return m_Storage.template has_service<InjectableTy>();
         }
 
+    public:
+        /// <summary>
+        /// Validates the registrations before building a provider, see base_service_provider.
+        /// Example: collection.validate();
+        /// </summary>
+        auto validate() -> result<bool>
+        {
+            return m_Storage.validate();
+        }
+
+        /// <summary>
+        /// Checks if the collection passed validation since its last registration.
+        /// </summary>
+        [[nodiscard]] bool is_validated() const noexcept
+        {
+            return m_Storage.is_validated();
+        }
+
+    public:
+        /// <summary>
+        /// Builds the dependency graph of the registered services.
+        /// Example: std::ofstream("services.dot") << collection.export_graph().to_dot();
+        /// </summary>
+        [[nodiscard]] service_graph export_graph() const
+        {
+            return service_graph(m_Storage.metadata());
+        }
+
     private:
         base_service_storage<StoragePolicyTy> m_Storage;
     };
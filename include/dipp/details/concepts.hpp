@@ -1,5 +1,8 @@
 #pragma once
 
+#include <ranges>
+#include <tuple>
+
 #include "service_lifetime.hpp"
 #include "type_key_pair.hpp"
 #include "move_only_any.hpp"
@@ -91,6 +94,16 @@ namespace dipp::details
         { t.load(std::declval<typename Ty::scope_type&>()) } -> std::same_as<move_only_any>;
     };
 
+    template<typename Ty>
+    concept typed_service_descriptor_type = service_descriptor_type<Ty> && requires(Ty t) {
+        // Required functions
+        // bool is_typed() const;
+        { std::as_const(t).is_typed() } -> std::same_as<bool>;
+
+        // result<value_type> construct(scope_type& scope);
+        t.construct(std::declval<typename Ty::scope_type&>());
+    };
+
     //
 
     template<typename Ty>
@@ -128,6 +141,20 @@ namespace dipp::details
 
     //
 
+    /// <summary>
+    /// A range of (descriptor, key) pairs, added to a collection in bulk.
+    /// </summary>
+    template<typename Ty>
+    concept service_registration_range_type =
+        std::ranges::input_range<Ty> &&
+        requires(std::ranges::range_reference_t<Ty> registration) {
+            requires service_descriptor_type<
+                std::remove_cvref_t<decltype(std::get<0>(registration))>>;
+            { std::get<1>(registration) } -> std::convertible_to<size_t>;
+        };
+
+    //
+
     template<typename Ty>
     concept container_type = requires(Ty t) {
         // Required functions
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "concepts.hpp"
+#include "result.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// Resolves a service by small integer keys, such as tenant ids or shard numbers, with an array
+    /// access. Singleton and scoped services are resolved from the scope on the first access of
+    /// each key and cached, transient services and keys past the size of the index are resolved
+    /// from the scope every time. The index must not outlive its scope.
+    /// Example: dipp::dense_service_index<TenantDbService> tenants(services.root_scope(), 16);
+    ///          auto db = tenants.get(tenant_id);
+    /// </summary>
+    template<base_injected_type InjectableTy>
+    class dense_service_index
+    {
+    public:
+        using scope_type = typename InjectableTy::descriptor_type::scope_type;
+        using result_type = result<InjectableTy>;
+
+        static constexpr bool is_cached =
+            InjectableTy::descriptor_type::lifetime != service_lifetime::transient;
+
+    public:
+        dense_service_index(scope_type& scope, size_t size)
+            : m_Scope(std::addressof(scope))
+        {
+            if constexpr (is_cached)
+            {
+                m_Services.resize(size);
+            }
+            m_Size = size;
+        }
+
+    public:
+        /// <summary>
+        /// Gets the service registered with the key.
+        /// </summary>
+        [[nodiscard]] auto get(size_t key) -> result_type
+        {
+            if constexpr (is_cached)
+            {
+                if (key < m_Services.size())
+                {
+                    auto& service = m_Services[key];
+                    if (!service)
+                    {
+                        auto instance = m_Scope->template get<InjectableTy>(key);
+                        if (instance.has_error()) [[unlikely]]
+                        {
+                            return instance;
+                        }
+                        service.emplace(*instance);
+                    }
+                    return make_result<InjectableTy>(*service);
+                }
+            }
+            return m_Scope->template get<InjectableTy>(key);
+        }
+
+        auto operator[](size_t key) -> result_type
+        {
+            return get(key);
+        }
+
+        /// <summary>
+        /// Gets the number of keys resolved with an array access.
+        /// </summary>
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_Size;
+        }
+
+    private:
+        scope_type* m_Scope;
+        std::vector<std::optional<InjectableTy>> m_Services;
+        size_t m_Size = 0;
+    };
+}
\ No newline at end of file
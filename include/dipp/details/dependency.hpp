@@ -1,5 +1,8 @@
 #pragma once
 
+#include <tuple>
+#include <vector>
+
 #include "concepts.hpp"
 
 namespace dipp::details
@@ -17,69 +20,168 @@ namespace dipp::details
     };
 
     /// <summary>
-    /// Get a tuple of dependencies from a scope.
+    /// Dependency on every registration of a service, injected as a contiguous container of the
+    /// resolved services in registration order. The services are resolved with a single lookup
+    /// each time the dependent service is constructed, and there may be none.
+    /// Example: dipp::dependency<dipp::all_of<HandlerService>>
     /// </summary>
-    template<dependency_container_type DepsTy, service_scope_type ScopeTy, std::size_t... Is>
-    auto get_tuple_from_scope_impl(ScopeTy& scope, std::index_sequence<Is...>)
+    template<base_injected_type InjectableTy>
+    class all_of
     {
-        using dependencies = typename DepsTy::types;
+    public:
+        using injected_type = InjectableTy;
+        using descriptor_type = typename InjectableTy::descriptor_type;
+        using value_type = std::vector<InjectableTy>;
+        static constexpr size_t key = InjectableTy::key;
 
-        return std::make_tuple(scope.template get<std::tuple_element_t<Is, dependencies>>()...);
-    }
+        using reference_type = value_type&;
+        using const_reference_type = const value_type&;
+        using pointer_type = value_type*;
+        using const_pointer_type = const value_type*;
 
-    /// <summary>
-    /// Get a tuple of dependencies from a scope.
-    /// </summary>
-    template<dependency_container_type DepsTy, service_scope_type ScopeTy>
-    auto get_tuple_from_scope(ScopeTy& scope) //-> result<typename DepsTy::types>
-    {
-        using dependencies_type = typename DepsTy::types;
-        constexpr auto dependencies_size = std::tuple_size_v<std::decay_t<dependencies_type>>;
+    public:
+        all_of(value_type services) noexcept
+            : m_Services(std::move(services))
+        {
+        }
 
-        // load all dependencies from the scope
-        return get_tuple_from_scope_impl<DepsTy>(
-            scope, std::make_index_sequence<std::tuple_size_v<dependencies_type>>{});
-    }
+    public:
+        /// <summary>
+        /// Get the services from the injected object.
+        /// </summary>
+        [[nodiscard]] const_reference_type get() const noexcept
+        {
+            return m_Services;
+        }
 
-    template<dependency_container_type DepsTy, typename ResultTy>
-    bool has_error_in_tuple(const ResultTy& deps)
-    {
-        using dependencies_type = typename DepsTy::types;
-        constexpr auto dependencies_size = std::tuple_size_v<std::decay_t<dependencies_type>>;
+        /// <summary>
+        /// Get the services from the injected object.
+        /// </summary>
+        [[nodiscard]] reference_type get() noexcept
+        {
+            return m_Services;
+        }
 
-        return [&]<size_t... I>(std::index_sequence<I...>)
+        [[nodiscard]] const_pointer_type operator->() const noexcept
         {
-            return ((std::get<I>(deps).has_error()) || ...);
-        }(std::make_index_sequence<dependencies_size>{});
-    }
+            return std::addressof(m_Services);
+        }
 
-#ifdef DIPP_USE_RESULT
-    template<dependency_container_type DepsTy, typename ResultTy>
-    auto get_error_from_tuple(ResultTy& deps) -> error_id
-    {
-        using dependencies_type = typename DepsTy::types;
-        constexpr auto dependencies_size = std::tuple_size_v<std::decay_t<dependencies_type>>;
-
-        return [&]<std::size_t... I>(std::index_sequence<I...>)
-        {
-            error_id err_id{};
-            ((void) (!err_id && (std::get<I>(deps).has_error() ? err_id = std::get<I>(deps).error()
-                                                               : error_id{})),
-             ...);
-            return err_id;
-        }(std::make_index_sequence<dependencies_size>{});
-    }
-#endif
-
-    template<dependency_container_type DepsTy, typename ResultTy>
-    auto unwrap_tuple_values(ResultTy&& deps)
-    {
-        using dependencies_type = typename DepsTy::types;
-        constexpr auto dependencies_size = std::tuple_size_v<std::decay_t<dependencies_type>>;
+        [[nodiscard]] pointer_type operator->() noexcept
+        {
+            return std::addressof(m_Services);
+        }
+
+        [[nodiscard]] const_reference_type operator*() const noexcept
+        {
+            return m_Services;
+        }
 
-        return [&]<std::size_t... I>(std::index_sequence<I...>) -> dependencies_type
+        [[nodiscard]] reference_type operator*() noexcept
         {
-            return std::make_tuple(std::move(std::get<I>(deps).value())...);
-        }(std::make_index_sequence<dependencies_size>{});
-    }
+            return m_Services;
+        }
+
+        operator value_type() && noexcept
+        {
+            return std::move(m_Services);
+        }
+
+    public:
+        [[nodiscard]] auto begin() noexcept
+        {
+            return m_Services.begin();
+        }
+
+        [[nodiscard]] auto begin() const noexcept
+        {
+            return m_Services.begin();
+        }
+
+        [[nodiscard]] auto end() noexcept
+        {
+            return m_Services.end();
+        }
+
+        [[nodiscard]] auto end() const noexcept
+        {
+            return m_Services.end();
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_Services.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_Services.empty();
+        }
+
+        [[nodiscard]] InjectableTy& operator[](size_t index) noexcept
+        {
+            return m_Services[index];
+        }
+
+        [[nodiscard]] const InjectableTy& operator[](size_t index) const noexcept
+        {
+            return m_Services[index];
+        }
+
+    private:
+        value_type m_Services;
+    };
+
+    template<typename Ty>
+    inline constexpr bool is_all_of_v = false;
+
+    template<base_injected_type InjectableTy>
+    inline constexpr bool is_all_of_v<all_of<InjectableTy>> = true;
+
+    //
+
+    /// <summary>
+    /// Identifies a dependency by its descriptor and key, all_of is distinguished from a dependency
+    /// on the last registration of the same service.
+    /// </summary>
+    template<base_injected_type DependencyTy>
+    inline constexpr size_t dependency_id_v =
+        combine_type_ids(type_id_v<typename DependencyTy::descriptor_type>, DependencyTy::key);
+
+    template<base_injected_type InjectableTy>
+    inline constexpr size_t dependency_id_v<all_of<InjectableTy>> =
+        combine_type_ids(static_cast<size_t>(fnv1a_hash("dipp::details::all_of")),
+                         dependency_id_v<InjectableTy>);
+
+    /// <summary>
+    /// The name of a dependency list spells out the dependencies of its dependencies, down to the
+    /// leaves of the graph, so its identifier combines the identifiers of the descriptors instead.
+    /// </summary>
+    template<base_injected_type... Deps>
+    struct type_id_of<dependency<Deps...>>
+    {
+        static constexpr size_t value = combine_type_ids(
+            static_cast<size_t>(fnv1a_hash("dipp::details::dependency")),
+            dependency_id_v<Deps>...);
+    };
+
+    /// <summary>
+    /// Descriptors are identified by their name without the dependencies, combined with the
+    /// identifier of the dependency list.
+    /// </summary>
+    template<template<typename,
+                      service_lifetime,
+                      service_scope_type,
+                      dependency_container_type> class DescTy,
+             typename Ty,
+             service_lifetime Lifetime,
+             service_scope_type ScopeTy,
+             dependency_container_type DepsTy>
+        requires(!std::is_same_v<DepsTy, dependency<>>)
+    struct type_id_of<DescTy<Ty, Lifetime, ScopeTy, DepsTy>>
+    {
+        static constexpr size_t value =
+            combine_type_ids(type_id_v<DescTy<Ty, Lifetime, ScopeTy, dependency<>>>,
+                             type_id_v<DepsTy>);
+    };
 }
\ No newline at end of file
@@ -5,6 +5,33 @@
 
 namespace dipp::details
 {
+    /// <summary>
+    /// Tag used to construct a descriptor from a factory that returns the value type directly.
+    /// </summary>
+    struct typed_factory_t
+    {
+        explicit typed_factory_t() = default;
+    };
+
+    inline constexpr typed_factory_t typed_factory{};
+
+    /// <summary>
+    /// Creates the value of a service, transient values are returned directly while cached values
+    /// are constructed in place inside a move_only_any.
+    /// </summary>
+    template<typename Ty, service_lifetime Lifetime, typename... ArgsTy>
+    [[nodiscard]] constexpr auto make_service_value(ArgsTy&&... args)
+    {
+        if constexpr (Lifetime == service_lifetime::transient)
+        {
+            return dipp::details::make_result<Ty>(std::forward<ArgsTy>(args)...);
+        }
+        else
+        {
+            return dipp::details::make_any<Ty>(std::forward<ArgsTy>(args)...);
+        }
+    }
+
     template<typename Ty,
              service_lifetime Lifetime,
              service_scope_type ScopeTy,
@@ -16,8 +43,10 @@ namespace dipp::details
         using scope_type = ScopeTy;
 #if _HAS_CXX23
         using functor_type = std::move_only_function<move_only_any(scope_type& scope)>;
+        using typed_functor_type = std::move_only_function<result<value_type>(scope_type& scope)>;
 #else
         using functor_type = std::function<move_only_any(scope_type& scope)>;
+        using typed_functor_type = std::function<result<value_type>(scope_type& scope)>;
 #endif
 
         static constexpr service_lifetime lifetime = Lifetime;
@@ -29,14 +58,69 @@ namespace dipp::details
         {
         }
 
+        constexpr functor_service_descriptor(typed_factory_t, typed_functor_type functor) noexcept(
+            std::is_nothrow_move_constructible_v<typed_functor_type>)
+            : m_TypedFunctor(std::move(functor))
+        {
+        }
+
     public:
         constexpr move_only_any load(scope_type& scope) noexcept(
-            std::is_nothrow_invocable_v<functor_type, scope_type&>)
+            std::is_nothrow_invocable_v<functor_type, scope_type&> &&
+            std::is_nothrow_invocable_v<typed_functor_type, scope_type&>)
         {
+            if constexpr (std::is_move_constructible_v<value_type>)
+            {
+                if (m_TypedFunctor)
+                {
+                    auto instance = m_TypedFunctor(scope);
+#ifdef DIPP_USE_RESULT
+                    if (instance.has_error()) [[unlikely]]
+                    {
+                        return move_only_any::make_error(instance.error());
+                    }
+#endif
+                    return dipp::details::make_any<value_type>(std::move(*instance));
+                }
+            }
             return m_Functor(scope);
         }
 
+        /// <summary>
+        /// Checks if the descriptor can construct the value directly without boxing it.
+        /// </summary>
+        [[nodiscard]] constexpr bool is_typed() const noexcept
+        {
+            return static_cast<bool>(m_TypedFunctor);
+        }
+
+        /// <summary>
+        /// Constructs the value directly, only valid if the descriptor is typed.
+        /// </summary>
+        constexpr result<value_type> construct(scope_type& scope) noexcept(
+            std::is_nothrow_invocable_v<typed_functor_type, scope_type&>)
+        {
+            return m_TypedFunctor(scope);
+        }
+
     private:
         functor_type m_Functor{};
+        typed_functor_type m_TypedFunctor{};
     };
+
+    /// <summary>
+    /// Creates a descriptor from a factory built with make_service_value.
+    /// </summary>
+    template<typename DescTy, typename FnTy>
+    [[nodiscard]] constexpr DescTy make_functor_descriptor(FnTy&& functor)
+    {
+        if constexpr (DescTy::lifetime == service_lifetime::transient)
+        {
+            return DescTy(typed_factory, std::forward<FnTy>(functor));
+        }
+        else
+        {
+            return DescTy(std::forward<FnTy>(functor));
+        }
+    }
 }
\ No newline at end of file
@@ -14,6 +14,7 @@ namespace dipp::details
         using base_class = functor_service_descriptor<Ty, Lifetime, ScopeTy, DepsTy>;
         using value_type = typename base_class::value_type;
         using functor_type = typename base_class::functor_type;
+        using typed_functor_type = typename base_class::typed_functor_type;
 
         constexpr local_service_descriptor(functor_type functor) noexcept(
             std::is_nothrow_move_constructible_v<functor_type>)
@@ -21,19 +22,26 @@ namespace dipp::details
         {
         }
 
+        constexpr local_service_descriptor(typed_factory_t tag,
+                                           typed_functor_type functor) noexcept(
+            std::is_nothrow_move_constructible_v<typed_functor_type>)
+            : base_class(tag, std::move(functor))
+        {
+        }
+
     public:
         template<typename ImplTy = Ty, typename... ArgsTy>
             requires(!std::is_abstract_v<ImplTy>)
         [[nodiscard]] static auto factory(ArgsTy&&... args)
         {
-            return local_service_descriptor(
+            return make_functor_descriptor<local_service_descriptor>(
                 [args = std::make_tuple(std::forward<ArgsTy>(args)...)](ScopeTy& scope) mutable
                 {
                     return dipp::details::apply<DepsTy>(
                         scope,
                         [](auto&&... params) mutable
                         {
-                            return dipp::details::make_any<Ty>(
+                            return dipp::details::make_service_value<Ty, Lifetime>(
                                 std::forward<decltype(params)>(params)...);
                         },
                         std::move(args));
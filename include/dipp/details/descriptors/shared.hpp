@@ -16,6 +16,7 @@ namespace dipp::details
             functor_service_descriptor<std::shared_ptr<Ty>, Lifetime, ScopeTy, DepsTy>;
         using value_type = typename base_class::value_type;
         using functor_type = typename base_class::functor_type;
+        using typed_functor_type = typename base_class::typed_functor_type;
 
         constexpr shared_service_descriptor(functor_type functor) noexcept(
             std::is_nothrow_move_constructible_v<functor_type>)
@@ -23,19 +24,26 @@ namespace dipp::details
         {
         }
 
+        constexpr shared_service_descriptor(typed_factory_t tag,
+                                            typed_functor_type functor) noexcept(
+            std::is_nothrow_move_constructible_v<typed_functor_type>)
+            : base_class(tag, std::move(functor))
+        {
+        }
+
     public:
         template<typename ImplTy = Ty, typename... ArgsTy>
             requires(!std::is_abstract_v<ImplTy> && std::derived_from<ImplTy, Ty>)
         [[nodiscard]] static auto factory(ArgsTy&&... args)
         {
-            return shared_service_descriptor(
+            return make_functor_descriptor<shared_service_descriptor>(
                 [args = std::make_tuple(std::forward<ArgsTy>(args)...)](ScopeTy& scope) mutable
                 {
                     return dipp::details::apply<DepsTy>(
                         scope,
                         [](auto&&... params) mutable
                         {
-                            return dipp::details::make_any<std::shared_ptr<Ty>>(
+                            return dipp::details::make_service_value<value_type, Lifetime>(
                                 std::make_shared<ImplTy>(
                                     std::forward<decltype(params)>(params)...));
                         },
@@ -49,14 +57,14 @@ namespace dipp::details
             using implementation_type = typename DescTy::value_type;
             using implementation_dependency_type = typename DescTy::dependency_type;
 
-            return shared_service_descriptor(
+            return make_functor_descriptor<shared_service_descriptor>(
                 [args = std::make_tuple(std::forward<ArgsTy>(args)...)](ScopeTy& scope) mutable
                 {
                     return dipp::details::apply<implementation_dependency_type>(
                         scope,
                         [](auto&&... params) mutable
                         {
-                            return dipp::details::make_any<std::shared_ptr<Ty>>(
+                            return dipp::details::make_service_value<value_type, Lifetime>(
                                 std::make_shared<implementation_type>(
                                     std::forward<decltype(params)>(params)...));
                         },
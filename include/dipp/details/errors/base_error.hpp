@@ -7,7 +7,20 @@
 
 namespace dipp::details
 {
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+    // flattened into an error_code, the name points to the static storage of type_name<Ty>()
+    struct base_error
+    {
+        constexpr base_error() = default;
+
+        constexpr explicit base_error(const char* typeName)
+            : TypeName(typeName)
+        {
+        }
+
+        const char* TypeName{};
+    };
+#elif defined(DIPP_USE_RESULT)
     struct base_error
     {
         constexpr base_error() = default;
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "base_error.hpp"
+#include "../type_id.hpp"
+
+namespace dipp::details
+{
+    class circular_dependency final : public details::base_error
+    {
+    private:
+        explicit circular_dependency(const char* typeName)
+            : details::base_error(typeName)
+        {
+        }
+
+    public:
+        template<typename Ty>
+        static auto error()
+        {
+            return circular_dependency(type_name<Ty>());
+        }
+
+        static auto error(const char* typeName)
+        {
+            return circular_dependency(typeName);
+        }
+    };
+}
\ No newline at end of file
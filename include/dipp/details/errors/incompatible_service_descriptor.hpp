@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base_error.hpp"
+#include "../type_id.hpp"
 
 namespace dipp::details
 {
@@ -16,7 +17,12 @@ namespace dipp::details
         template<typename Ty>
         static auto error()
         {
-            return incompatible_service_descriptor(typeid(Ty).name());
+            return incompatible_service_descriptor(type_name<Ty>());
+        }
+
+        static auto error(const char* typeName)
+        {
+            return incompatible_service_descriptor(typeName);
         }
     };
 }
\ No newline at end of file
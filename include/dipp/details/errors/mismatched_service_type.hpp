@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base_error.hpp"
+#include "../type_id.hpp"
 
 namespace dipp::details
 {
@@ -16,7 +17,12 @@ namespace dipp::details
         template<typename Ty>
         static auto error()
         {
-            return mismatched_service_type(typeid(Ty).name());
+            return mismatched_service_type(type_name<Ty>());
+        }
+
+        static auto error(const char* typeName)
+        {
+            return mismatched_service_type(typeName);
         }
     };
 }
\ No newline at end of file
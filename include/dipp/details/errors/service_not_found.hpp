@@ -1,6 +1,7 @@
 #pragma once
 
 #include "base_error.hpp"
+#include "../type_id.hpp"
 
 namespace dipp::details
 {
@@ -16,7 +17,12 @@ namespace dipp::details
         template<typename Ty>
         static auto error()
         {
-            return service_not_found(typeid(Ty).name());
+            return service_not_found(type_name<Ty>());
+        }
+
+        static auto error(const char* typeName)
+        {
+            return service_not_found(typeName);
         }
     };
 }
\ No newline at end of file
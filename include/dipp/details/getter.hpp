@@ -11,20 +11,25 @@ namespace dipp::details
     {
     public:
         using scope_type = typename InjectableTy::descriptor_type::scope_type;
-        using service_loader_type = service_loader<scope_type, SingletonMemTy, ScopedMemTy>;
+        using observer_type = typename scope_type::storage_type::observer_type;
+        using service_loader_type =
+            service_loader<scope_type, SingletonMemTy, ScopedMemTy, observer_type>;
 
         using result_type = result<InjectableTy>;
 
     public:
-        base_service_getter(service_loader_type& loader, move_only_any& service) noexcept
+        base_service_getter(service_loader_type& loader,
+                            const type_key_pair& handle,
+                            move_only_any& service) noexcept
             : m_Loader(loader)
+            , m_Handle(handle)
             , m_Service(service)
         {
         }
 
         [[nodiscard]] auto get() -> result_type
         {
-            return m_Loader.template load<InjectableTy>(m_Service);
+            return m_Loader.template load<InjectableTy>(m_Handle, m_Service);
         }
 
         auto operator()() -> result_type
@@ -34,6 +39,7 @@ namespace dipp::details
 
     private:
         service_loader_type& m_Loader;
+        const type_key_pair& m_Handle;
         move_only_any& m_Service;
     };
 
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "service_metadata.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// A service in the dependency graph, identified by its (type, key) handle.
+    /// </summary>
+    struct service_graph_node
+    {
+        type_key_pair handle{};
+        const char* type_name{};
+        service_lifetime lifetime{};
+
+        // false if the service is only known as a dependency of another service
+        bool registered{};
+        size_t registrations{};
+
+        // indices of the nodes this service depends on
+        std::vector<size_t> dependencies;
+
+        size_t fan_in{};
+        size_t fan_out{};
+        // longest chain of dependencies below this service
+        size_t depth{};
+        // number of distinct services constructed transitively by this service
+        size_t subgraph_size{};
+        bool in_cycle{};
+    };
+
+    /// <summary>
+    /// The dependency graph of a collection, built from the metadata retained at registration.
+    /// Each node uses the last registration of its handle, the one a scope resolves.
+    /// </summary>
+    class service_graph
+    {
+    public:
+        explicit service_graph(std::span<const service_metadata> metadata)
+        {
+            std::map<type_key_pair, std::span<const service_dependency_info>> last_dependencies;
+
+            for (auto& entry : metadata)
+            {
+                auto& node = m_Nodes[get_or_add_node(entry.handle, entry.type_name)];
+                node.registered = true;
+                node.registrations++;
+                node.type_name = entry.type_name;
+                node.lifetime = entry.lifetime;
+                node.dependencies.clear();
+
+                // resolved after all nodes exist, as the node vector may still grow
+                last_dependencies[entry.handle] = entry.dependencies;
+            }
+
+            for (auto& [handle, dependencies] : last_dependencies)
+            {
+                auto index = m_Indices.at(handle);
+                for (auto& dependency : dependencies)
+                {
+                    auto dependency_index =
+                        get_or_add_node(dependency.handle, dependency.type_name);
+                    m_Nodes[index].dependencies.push_back(dependency_index);
+                }
+            }
+
+            compute_statistics();
+        }
+
+    public:
+        [[nodiscard]] const std::vector<service_graph_node>& nodes() const noexcept
+        {
+            return m_Nodes;
+        }
+
+        [[nodiscard]] size_t edge_count() const noexcept
+        {
+            size_t count = 0;
+            for (auto& node : m_Nodes)
+            {
+                count += node.dependencies.size();
+            }
+            return count;
+        }
+
+        [[nodiscard]] size_t max_depth() const noexcept
+        {
+            return max_of(&service_graph_node::depth);
+        }
+
+        [[nodiscard]] size_t max_fan_in() const noexcept
+        {
+            return max_of(&service_graph_node::fan_in);
+        }
+
+        [[nodiscard]] size_t max_fan_out() const noexcept
+        {
+            return max_of(&service_graph_node::fan_out);
+        }
+
+    public:
+        /// <summary>
+        /// Writes the graph in Graphviz DOT format, unregistered dependencies are dashed.
+        /// </summary>
+        [[nodiscard]] std::string to_dot() const
+        {
+            std::ostringstream stream;
+
+            stream << "digraph dipp {\n";
+            for (size_t i = 0; i < m_Nodes.size(); i++)
+            {
+                auto& node = m_Nodes[i];
+                stream << "    n" << i << " [label=\"";
+                write_escaped(stream, node.type_name);
+                stream << "\\nkey=" << node.handle.second;
+                if (node.registered)
+                {
+                    stream << "\\n" << lifetime_name(node.lifetime);
+                }
+                stream << "\\nfan_in=" << node.fan_in << " fan_out=" << node.fan_out
+                       << " depth=" << node.depth << "\"";
+                if (!node.registered)
+                {
+                    stream << ", style=dashed";
+                }
+                else if (node.in_cycle)
+                {
+                    stream << ", color=red";
+                }
+                stream << "];\n";
+            }
+
+            for (size_t i = 0; i < m_Nodes.size(); i++)
+            {
+                for (auto dependency : m_Nodes[i].dependencies)
+                {
+                    stream << "    n" << i << " -> n" << dependency << ";\n";
+                }
+            }
+            stream << "}\n";
+
+            return stream.str();
+        }
+
+        /// <summary>
+        /// Writes the graph as JSON, with per-node statistics and a summary.
+        /// </summary>
+        [[nodiscard]] std::string to_json() const
+        {
+            std::ostringstream stream;
+
+            stream << "{\"nodes\":[";
+            for (size_t i = 0; i < m_Nodes.size(); i++)
+            {
+                auto& node = m_Nodes[i];
+                if (i != 0)
+                {
+                    stream << ',';
+                }
+
+                stream << "{\"id\":" << i << ",\"name\":\"";
+                write_escaped(stream, node.type_name);
+                stream << "\",\"key\":" << node.handle.second << ",\"lifetime\":";
+                if (node.registered)
+                {
+                    stream << '"' << lifetime_name(node.lifetime) << '"';
+                }
+                else
+                {
+                    stream << "null";
+                }
+                stream << ",\"registered\":" << (node.registered ? "true" : "false")
+                       << ",\"registrations\":" << node.registrations
+                       << ",\"fan_in\":" << node.fan_in << ",\"fan_out\":" << node.fan_out
+                       << ",\"depth\":" << node.depth
+                       << ",\"subgraph_size\":" << node.subgraph_size
+                       << ",\"in_cycle\":" << (node.in_cycle ? "true" : "false") << '}';
+            }
+
+            stream << "],\"edges\":[";
+            bool first = true;
+            for (size_t i = 0; i < m_Nodes.size(); i++)
+            {
+                for (auto dependency : m_Nodes[i].dependencies)
+                {
+                    if (!std::exchange(first, false))
+                    {
+                        stream << ',';
+                    }
+                    stream << "{\"from\":" << i << ",\"to\":" << dependency << '}';
+                }
+            }
+
+            stream << "],\"stats\":{\"nodes\":" << m_Nodes.size()
+                   << ",\"edges\":" << edge_count() << ",\"max_depth\":" << max_depth()
+                   << ",\"max_fan_in\":" << max_fan_in() << ",\"max_fan_out\":" << max_fan_out()
+                   << "}}";
+
+            return stream.str();
+        }
+
+    private:
+        size_t get_or_add_node(const type_key_pair& handle, const char* type_name)
+        {
+            auto [iter, inserted] = m_Indices.try_emplace(handle, m_Nodes.size());
+            if (inserted)
+            {
+                m_Nodes.push_back(service_graph_node{.handle = handle, .type_name = type_name});
+            }
+            return iter->second;
+        }
+
+        void compute_statistics()
+        {
+            for (auto& node : m_Nodes)
+            {
+                node.fan_out = node.dependencies.size();
+                for (auto dependency : node.dependencies)
+                {
+                    m_Nodes[dependency].fan_in++;
+                }
+            }
+
+            enum class visit_state : unsigned char
+            {
+                unvisited,
+                visiting,
+                done
+            };
+            std::vector<visit_state> states(m_Nodes.size(), visit_state::unvisited);
+
+            auto compute_depth = [&](auto& self, size_t index) -> size_t
+            {
+                auto& node = m_Nodes[index];
+                if (states[index] == visit_state::done)
+                {
+                    return node.depth;
+                }
+
+                states[index] = visit_state::visiting;
+                size_t depth = 0;
+                for (auto dependency : node.dependencies)
+                {
+                    if (states[dependency] == visit_state::visiting)
+                    {
+                        node.in_cycle = true;
+                        m_Nodes[dependency].in_cycle = true;
+                        continue;
+                    }
+                    depth = std::max(depth, self(self, dependency) + 1);
+                }
+
+                states[index] = visit_state::done;
+                node.depth = depth;
+                return depth;
+            };
+
+            std::vector<bool> reached;
+            std::vector<size_t> pending;
+            for (size_t i = 0; i < m_Nodes.size(); i++)
+            {
+                compute_depth(compute_depth, i);
+
+                reached.assign(m_Nodes.size(), false);
+                pending.assign(m_Nodes[i].dependencies.begin(), m_Nodes[i].dependencies.end());
+                reached[i] = true;
+
+                size_t subgraph_size = 0;
+                while (!pending.empty())
+                {
+                    auto index = pending.back();
+                    pending.pop_back();
+                    if (reached[index])
+                    {
+                        continue;
+                    }
+
+                    reached[index] = true;
+                    subgraph_size++;
+                    pending.insert(pending.end(),
+                                   m_Nodes[index].dependencies.begin(),
+                                   m_Nodes[index].dependencies.end());
+                }
+                m_Nodes[i].subgraph_size = subgraph_size;
+            }
+        }
+
+        [[nodiscard]] size_t max_of(size_t service_graph_node::* member) const noexcept
+        {
+            size_t value = 0;
+            for (auto& node : m_Nodes)
+            {
+                value = std::max(value, node.*member);
+            }
+            return value;
+        }
+
+        [[nodiscard]] static const char* lifetime_name(service_lifetime lifetime) noexcept
+        {
+            switch (lifetime)
+            {
+                case service_lifetime::singleton:
+                    return "singleton";
+                case service_lifetime::scoped:
+                    return "scoped";
+                case service_lifetime::transient:
+                    return "transient";
+            }
+            return "unknown";
+        }
+
+        static void write_escaped(std::ostream& stream, std::string_view text)
+        {
+            for (char c : text)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    stream << '\\';
+                }
+                stream << c;
+            }
+        }
+
+    private:
+        std::vector<service_graph_node> m_Nodes;
+        std::map<type_key_pair, size_t> m_Indices;
+    };
+}
\ No newline at end of file
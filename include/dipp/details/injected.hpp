@@ -4,5 +4,6 @@
 #include "injected/functor.hpp"
 #include "injected/unique.hpp"
 #include "injected/shared.hpp"
+#include "injected/shared_ref.hpp"
 #include "injected/ref.hpp"
 #include "injected/local.hpp"
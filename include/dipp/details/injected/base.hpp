@@ -38,7 +38,7 @@ namespace dipp::details
         constexpr base_injected(service_type& value) noexcept(
             std::is_nothrow_copy_constructible_v<service_type>)
             requires(((descriptor_type::lifetime == service_lifetime::singleton) ||
-                      (descriptor_type::lifetime == service_lifetime::scope)))
+                      (descriptor_type::lifetime == service_lifetime::scoped)))
             : m_Value(value)
         {
         }
@@ -55,9 +55,8 @@ namespace dipp::details
         /// <summary>
         /// Detach the service from the injected object.
         /// </summary>
-        template<
-            typename = std::enable_if_t<descriptor_type::lifetime == service_lifetime::transient>>
         [[nodiscard]] constexpr auto detach() noexcept
+            requires(descriptor_type::lifetime == service_lifetime::transient)
         {
             return std::move(m_Value);
         }
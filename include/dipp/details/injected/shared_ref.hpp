@@ -0,0 +1,137 @@
+#pragma once
+
+#include "base.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// Borrows a singleton/scoped shared service without copying its std::shared_ptr.
+    /// Resolves the same registration as injected_shared, the reference stays valid for as long as
+    /// the scope that owns the instance.
+    /// </summary>
+    template<typename Ty,
+             service_lifetime Lifetime,
+             dependency_container_type DepsTy = dependency<>,
+             size_t Key = size_t{},
+             service_scope_type ScopeTy = service_scope>
+        requires(Lifetime != service_lifetime::transient)
+    class injected_shared_ref
+    {
+    public:
+        using descriptor_type = shared_service_descriptor<Ty, Lifetime, ScopeTy, DepsTy>;
+        using value_type = typename descriptor_type::value_type;
+        using service_type = typename descriptor_type::service_type;
+        static constexpr size_t key = Key;
+
+        using reference_type = std::add_lvalue_reference_t<Ty>;
+        using const_reference_type = std::add_lvalue_reference_t<std::add_const_t<Ty>>;
+        using pointer_type = std::add_pointer_t<Ty>;
+        using const_pointer_type = std::add_pointer_t<std::add_const_t<Ty>>;
+
+    public:
+        constexpr injected_shared_ref(value_type& value) noexcept
+            : m_Value(std::addressof(value))
+        {
+        }
+
+    public:
+        /// <summary>
+        /// Get the cached shared pointer without copying it.
+        /// </summary>
+        [[nodiscard]] constexpr const value_type& shared() const noexcept
+        {
+            return *m_Value;
+        }
+
+        /// <summary>
+        /// Get the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr const_reference_type get() const noexcept
+        {
+            return **m_Value;
+        }
+
+        /// <summary>
+        /// Get the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr reference_type get() noexcept
+        {
+            return **m_Value;
+        }
+
+        /// <summary>
+        /// Get the address of the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr const_pointer_type ptr() const noexcept
+        {
+            return m_Value->get();
+        }
+
+        /// <summary>
+        /// Get the address of the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr pointer_type ptr() noexcept
+        {
+            return m_Value->get();
+        }
+
+        /// <summary>
+        /// Get the address of the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr const_pointer_type operator->() const noexcept
+        {
+            return ptr();
+        }
+
+        /// <summary>
+        /// Get the address of the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr pointer_type operator->() noexcept
+        {
+            return ptr();
+        }
+
+        /// <summary>
+        /// Get the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr const_reference_type operator*() const noexcept
+        {
+            return get();
+        }
+
+        /// <summary>
+        /// Get the service from the injected object.
+        /// </summary>
+        [[nodiscard]] constexpr reference_type operator*() noexcept
+        {
+            return get();
+        }
+
+    public:
+        constexpr operator const value_type&() const noexcept
+        {
+            return shared();
+        }
+
+        constexpr operator const Ty&() const noexcept
+        {
+            return get();
+        }
+        constexpr operator Ty&() noexcept
+        {
+            return get();
+        }
+
+        constexpr operator const Ty*() const noexcept
+        {
+            return ptr();
+        }
+        constexpr operator Ty*() noexcept
+        {
+            return ptr();
+        }
+
+    private:
+        value_type* m_Value;
+    };
+}
\ No newline at end of file
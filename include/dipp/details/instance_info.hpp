@@ -33,6 +33,12 @@ namespace dipp::details
         }
 #endif
 
+        [[nodiscard]]
+        bool is_heap_allocated() const noexcept
+        {
+            return Instance.is_heap_allocated();
+        }
+
         template<typename Ty>
         [[nodiscard]]
         auto cast() noexcept
@@ -40,6 +46,13 @@ namespace dipp::details
             return Instance.cast<Ty>();
         }
 
+        template<typename Ty>
+        [[nodiscard]]
+        auto unchecked_cast() noexcept
+        {
+            return Instance.unchecked_cast<Ty>();
+        }
+
         move_only_any Instance;
     };
 }
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cassert>
+
 #include "policy.hpp"
 #include "move_only_any.hpp"
 
+#include "service_vtable.hpp"
 #include "result.hpp"
 #include "fail.hpp"
 
@@ -14,47 +17,60 @@ namespace dipp::details
 {
     template<service_scope_type ScopeTy,
              service_storage_memory_type SingletonMemTy,
-             service_storage_memory_type ScopedMemTy>
+             service_storage_memory_type ScopedMemTy,
+             typename ObserverTy>
     struct service_loader
     {
         ScopeTy& scope;
         SingletonMemTy& singleton_storage;
         ScopedMemTy& scoped_storage;
+        ObserverTy& observer;
+
+        // set once the storage passed validation, the per-call compatibility checks are skipped
+        bool validated = false;
+
+        using vtable_type = service_vtable<ObserverTy>;
+
+        template<service_storage_memory_type MemTy>
+        using emplace_instance_fn =
+            decltype(std::declval<MemTy&>().find(std::declval<const type_key_pair&>())) (*)(
+                MemTy&, const type_key_pair&, move_only_any&, ScopeTy&);
 
+        /// <summary>
+        /// Loads the service registered by the descriptor, the typed wrappers below only pick the
+        /// vtable and cast the result while the rest is shared by every service of the policy.
+        /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] auto load(move_only_any& service) -> result<InjectableTy>
+        [[nodiscard]] auto load(const type_key_pair& service_handle, move_only_any& service)
+            -> result<InjectableTy>
         {
-            return load_service_impl<InjectableTy>(
-                service, scope, singleton_storage, scoped_storage);
+            return load<InjectableTy>(service_handle, std::addressof(service));
         }
 
-    private:
         /// <summary>
-        /// Loads a service from the storage with the specified key.
+        /// Loads the service registered by the descriptor, reports service_not_found if the
+        /// descriptor is null.
         /// </summary>
-        template<base_injected_type InjectableTy,
-                 service_storage_memory_type SingletonMemTy,
-                 service_storage_memory_type ScopedMemTy>
-        [[nodiscard]] static auto load_service_impl(
-            move_only_any& service,
-            typename InjectableTy::descriptor_type::scope_type& scope,
-            SingletonMemTy& singleton_storage,
-            ScopedMemTy& scoped_storage) -> result<InjectableTy>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] auto load(const type_key_pair& service_handle, move_only_any* service)
+            -> result<InjectableTy>
         {
             using descriptor_type = typename InjectableTy::descriptor_type;
-            using service_type = typename descriptor_type::service_type;
 
+            auto& vtable = service_vtable_v<InjectableTy, ObserverTy>;
             if constexpr (descriptor_type::lifetime == service_lifetime::singleton)
             {
-                return load_mem_service<InjectableTy>(service, scope, singleton_storage);
+                return load_mem_service<InjectableTy>(
+                    service_handle, service, singleton_storage, vtable);
             }
             else if constexpr (descriptor_type::lifetime == service_lifetime::scoped)
             {
-                return load_mem_service<InjectableTy>(service, scope, scoped_storage);
+                return load_mem_service<InjectableTy>(
+                    service_handle, service, scoped_storage, vtable);
             }
             else if constexpr (descriptor_type::lifetime == service_lifetime::transient)
             {
-                return load_transient_service<InjectableTy>(service, scope);
+                return load_transient_service<InjectableTy>(service_handle, service, vtable);
             }
             else
             {
@@ -67,91 +83,247 @@ namespace dipp::details
         /// Loads a scoped/singleton service from storage.
         /// </summary>
         template<base_injected_type InjectableTy, service_storage_memory_type MemTy>
-        [[nodiscard]] static auto load_mem_service(
-            move_only_any& service,
-            typename InjectableTy::descriptor_type::scope_type& scope,
-            MemTy& storage) -> result<InjectableTy>
+        [[nodiscard]] auto load_mem_service(const type_key_pair& service_handle,
+                                            move_only_any* service,
+                                            MemTy& storage,
+                                            const vtable_type& vtable) -> result<InjectableTy>
         {
             using descriptor_type = typename InjectableTy::descriptor_type;
-            using service_type = typename descriptor_type::service_type;
-            using value_type = typename descriptor_type::value_type;
 
-            auto handle = make_type_key(typeid(descriptor_type).hash_code(),
-                                        std::bit_cast<size_t>(std::addressof(service)));
-            auto instance_iter = storage.find(handle);
+            auto instance = load_instance(service_handle,
+                                          service,
+                                          storage,
+                                          vtable,
+                                          &emplace_instance<descriptor_type, MemTy>);
+#ifdef DIPP_USE_RESULT
+            if (instance.has_error()) [[unlikely]]
+            {
+                return instance.error();
+            }
+#endif
 
-            if (instance_iter == nullptr)
+            return unwrap_instance<InjectableTy>(service_handle, **instance, vtable);
+        }
+
+        /// <summary>
+        /// Loads a transient service from storage.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] auto load_transient_service(const type_key_pair& service_handle,
+                                                  move_only_any* service,
+                                                  const vtable_type& vtable)
+            -> result<InjectableTy>
+        {
+            using descriptor_type = typename InjectableTy::descriptor_type;
+
+            auto checked_service = find_descriptor(service_handle, service, vtable);
+#ifdef DIPP_USE_RESULT
+            if (checked_service.has_error()) [[unlikely]]
             {
-                auto descriptor = service.cast<descriptor_type>();
-                if (!descriptor) [[unlikely]]
+                return checked_service.error();
+            }
+#endif
+
+            auto& descriptor =
+                (*checked_service)->template unchecked_cast<descriptor_type>()->value();
+
+            // built-in descriptors construct the value directly, skipping the move_only_any box
+            if constexpr (typed_service_descriptor_type<descriptor_type>)
+            {
+                if (descriptor.is_typed())
                 {
-                    DIPP_RETURN_ERROR(incompatible_service_descriptor::error<service_type>());
+                    auto instance = construct_transient(
+                        service_handle, vtable, [&] { return descriptor.construct(scope); });
+#ifdef DIPP_USE_RESULT
+                    if (instance.has_error()) [[unlikely]]
+                    {
+                        vtable.on_event(observer, service_event::error, service_handle);
+                        return instance.error();
+                    }
+#endif
+                    return make_result<InjectableTy>(std::move(*instance));
                 }
+            }
 
-                instance_iter = storage.emplace(handle, descriptor->value(), scope);
+            auto loaded_instance = construct_transient(
+                service_handle, vtable, [&] { return descriptor.load(scope); });
+            if (loaded_instance.is_heap_allocated())
+            {
+                vtable.on_event(observer, service_event::allocation, service_handle);
             }
 
+            auto instance = check_instance(service_handle, loaded_instance, vtable);
 #ifdef DIPP_USE_RESULT
-            if (instance_iter->has_error()) [[unlikely]]
+            if (instance.has_error()) [[unlikely]]
             {
-                return instance_iter->error();
+                return instance.error();
             }
 #endif
 
-            auto instance = instance_iter->cast<value_type>();
-            if (!instance || instance->has_error()) [[unlikely]]
+            return unwrap_instance<InjectableTy>(service_handle, **instance, vtable);
+        }
+
+        /// <summary>
+        /// Gets the value of a checked instance, transient values are moved out of their box while
+        /// singletons and scoped services stay in their storage.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] auto unwrap_instance(const type_key_pair& service_handle,
+                                           move_only_any& instance,
+                                           const vtable_type& vtable) -> result<InjectableTy>
+        {
+            using descriptor_type = typename InjectableTy::descriptor_type;
+            using value_type = typename descriptor_type::value_type;
+
+            auto value = instance.template unchecked_cast<value_type>();
+#ifdef DIPP_USE_RESULT
+            if (value->has_error()) [[unlikely]]
+            {
+                vtable.on_event(observer, service_event::error, service_handle);
+                return value->error();
+            }
+#endif
+            if constexpr (descriptor_type::lifetime == service_lifetime::transient)
+            {
+                return make_result<InjectableTy>(std::move(value->value()));
+            }
+            else
+            {
+                return make_result<InjectableTy>(value->value());
+            }
+        }
+
+        /// <summary>
+        /// Constructs the instance of a singleton/scoped descriptor in the storage.
+        /// </summary>
+        template<service_descriptor_type DescTy, service_storage_memory_type MemTy>
+        [[nodiscard]] static auto emplace_instance(MemTy& storage,
+                                                   const type_key_pair& handle,
+                                                   move_only_any& service,
+                                                   ScopeTy& scope)
+        {
+            auto& descriptor = service.template unchecked_cast<DescTy>()->value();
+            return storage.emplace(handle, descriptor, scope);
+        }
+
+        /// <summary>
+        /// Constructs a transient instance while reporting the construction to the observer.
+        /// </summary>
+        template<typename FnTy>
+        [[nodiscard]] auto construct_transient(const type_key_pair& service_handle,
+                                               const vtable_type& vtable,
+                                               FnTy&& construct)
+        {
+            observed_construction<ObserverTy> construction{observer, vtable, service_handle};
+            return construct();
+        }
+
+    private:
+        /// <summary>
+        /// Gets the cached instance of a singleton/scoped service, constructing it on first use.
+        /// A missing registration never has a cached instance and is reported by find_descriptor.
+        /// </summary>
+        template<service_storage_memory_type MemTy>
+        [[nodiscard]] auto load_instance(
+            const type_key_pair& service_handle,
+            move_only_any* service,
+            MemTy& storage,
+            const vtable_type& vtable,
+            emplace_instance_fn<MemTy> emplace) -> result<move_only_any*>
+        {
+            auto handle = make_type_key(vtable.descriptor_type, std::bit_cast<size_t>(service));
+            auto instance_iter = storage.find(handle);
+
+            if (instance_iter == nullptr)
             {
+                auto checked_service = find_descriptor(service_handle, service, vtable);
 #ifdef DIPP_USE_RESULT
-                if (instance)
+                if (checked_service.has_error()) [[unlikely]]
                 {
-                    return instance->error();
+                    return checked_service.error();
                 }
 #endif
-                DIPP_RETURN_ERROR(mismatched_service_type::error<service_type>());
+
+                {
+                    observed_construction<ObserverTy> construction{
+                        observer, vtable, service_handle};
+                    instance_iter = emplace(storage, handle, **checked_service, scope);
+                }
+
+                if (instance_iter->is_heap_allocated())
+                {
+                    vtable.on_event(observer, service_event::allocation, service_handle);
+                }
             }
+            else
+            {
+                vtable.on_event(observer, service_event::cache_hit, service_handle);
 
-            return make_result<InjectableTy>(instance->value());
+#ifdef DIPP_USE_RESULT
+                if (validated && !instance_iter->has_error())
+#else
+                if (validated)
+#endif
+                {
+                    // the instance was checked when it was constructed
+                    return make_result<move_only_any*>(std::addressof(instance_iter->Instance));
+                }
+            }
+
+            return check_instance(service_handle, instance_iter->Instance, vtable);
         }
 
         /// <summary>
-        /// Loads a transient service from storage.
+        /// Checks that the service is registered with the descriptor of the vtable, once validated
+        /// every registration of a handle is known to share the descriptor type of its consumers.
         /// </summary>
-        template<base_injected_type InjectableTy>
-        [[nodiscard]] static auto load_transient_service(
-            move_only_any& service,
-            typename InjectableTy::descriptor_type::scope_type& scope) -> result<InjectableTy>
+        [[nodiscard]] auto find_descriptor(const type_key_pair& service_handle,
+                                           move_only_any* service,
+                                           const vtable_type& vtable) -> result<move_only_any*>
         {
-            using descriptor_type = typename InjectableTy::descriptor_type;
-            using service_type = typename descriptor_type::service_type;
-            using value_type = typename descriptor_type::value_type;
+            if (service == nullptr) [[unlikely]]
+            {
+                vtable.on_event(observer, service_event::error, service_handle);
+                DIPP_RETURN_ERROR(service_not_found::error(vtable.service_type_name()));
+            }
 
-            auto descriptor = service.cast<descriptor_type>();
-            if (!descriptor) [[unlikely]]
+            if (validated)
+            {
+                assert(service->holds(vtable.descriptor_type) &&
+                       "service requested with another descriptor than registered");
+            }
+            else if (!service->holds(vtable.descriptor_type)) [[unlikely]]
             {
-                DIPP_RETURN_ERROR(incompatible_service_descriptor::error<service_type>());
+                vtable.on_event(observer, service_event::error, service_handle);
+                DIPP_RETURN_ERROR(
+                    incompatible_service_descriptor::error(vtable.service_type_name()));
             }
 
-            auto loaded_instance = descriptor->value().load(scope);
+            return make_result<move_only_any*>(service);
+        }
+
+        /// <summary>
+        /// Checks that the loaded instance holds the value type of the vtable.
+        /// </summary>
+        [[nodiscard]] auto check_instance(const type_key_pair& service_handle,
+                                          move_only_any& instance,
+                                          const vtable_type& vtable) -> result<move_only_any*>
+        {
 #ifdef DIPP_USE_RESULT
-            if (loaded_instance.has_error()) [[unlikely]]
+            if (instance.has_error()) [[unlikely]]
             {
-                return loaded_instance.error();
+                vtable.on_event(observer, service_event::error, service_handle);
+                return instance.error();
             }
 #endif
 
-            auto instance = loaded_instance.cast<value_type>();
-            if (!instance || instance->has_error()) [[unlikely]]
+            if (!instance.holds(vtable.value_type)) [[unlikely]]
             {
-#ifdef DIPP_USE_RESULT
-                if (instance)
-                {
-                    return instance->error();
-                }
-#endif
-                DIPP_RETURN_ERROR(mismatched_service_type::error<service_type>());
+                vtable.on_event(observer, service_event::error, service_handle);
+                DIPP_RETURN_ERROR(mismatched_service_type::error(vtable.service_type_name()));
             }
 
-            return make_result<InjectableTy>(std::move(instance->value()));
+            return make_result<move_only_any*>(std::addressof(instance));
         }
     };
 }
\ No newline at end of file
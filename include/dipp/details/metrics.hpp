@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "collection.hpp"
+#include "provider.hpp"
+#include "type_id.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// Aggregated numbers for a single registration, as returned by a metrics snapshot.
+    /// </summary>
+    struct service_metrics
+    {
+        type_key_pair handle{};
+        const char* type_name{};
+
+        size_t resolutions{};
+        size_t cache_hits{};
+        size_t constructions{};
+        size_t allocations{};
+        size_t errors{};
+
+        std::chrono::nanoseconds total_construction_time{};
+        std::chrono::nanoseconds max_construction_time{};
+    };
+
+    /// <summary>
+    /// Observer collecting per-registration resolution counts and construction latencies.
+    /// Counters are updated with relaxed atomics, the registration table is only locked
+    /// exclusively the first time a registration is seen.
+    /// </summary>
+    class metrics_service_observer
+    {
+    private:
+        using clock_type = std::chrono::steady_clock;
+
+        struct counters
+        {
+            const char* type_name{};
+
+            std::atomic<size_t> resolutions{};
+            std::atomic<size_t> cache_hits{};
+            std::atomic<size_t> constructions{};
+            std::atomic<size_t> allocations{};
+            std::atomic<size_t> errors{};
+
+            std::atomic<long long> total_construction_time{};
+            std::atomic<long long> max_construction_time{};
+        };
+
+        struct state
+        {
+            std::shared_mutex mutex;
+            std::map<type_key_pair, counters> entries;
+        };
+
+    public:
+        template<base_injected_type InjectableTy>
+        void on_lookup(const type_key_pair& handle)
+        {
+            get_counters<InjectableTy>(handle).resolutions.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_cache_hit(const type_key_pair& handle)
+        {
+            get_counters<InjectableTy>(handle).cache_hits.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_construct_begin(const type_key_pair&)
+        {
+            construction_stack().push_back(clock_type::now());
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_construct_end(const type_key_pair& handle)
+        {
+            auto& stack = construction_stack();
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() -
+                                                                                stack.back())
+                               .count();
+            stack.pop_back();
+
+            auto& entry = get_counters<InjectableTy>(handle);
+            entry.constructions.fetch_add(1, std::memory_order_relaxed);
+            entry.total_construction_time.fetch_add(elapsed, std::memory_order_relaxed);
+
+            auto max_time = entry.max_construction_time.load(std::memory_order_relaxed);
+            while (max_time < elapsed &&
+                   !entry.max_construction_time.compare_exchange_weak(
+                       max_time, elapsed, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_allocation(const type_key_pair& handle)
+        {
+            get_counters<InjectableTy>(handle).allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_error(const type_key_pair& handle)
+        {
+            get_counters<InjectableTy>(handle).errors.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    public:
+        /// <summary>
+        /// Copies the current counters of every registration seen so far.
+        /// </summary>
+        [[nodiscard]] std::vector<service_metrics> snapshot() const
+        {
+            std::vector<service_metrics> result;
+
+            std::shared_lock lock(m_State->mutex);
+            result.reserve(m_State->entries.size());
+
+            for (auto& [handle, entry] : m_State->entries)
+            {
+                result.push_back(service_metrics{
+                    .handle = handle,
+                    .type_name = entry.type_name,
+                    .resolutions = entry.resolutions.load(std::memory_order_relaxed),
+                    .cache_hits = entry.cache_hits.load(std::memory_order_relaxed),
+                    .constructions = entry.constructions.load(std::memory_order_relaxed),
+                    .allocations = entry.allocations.load(std::memory_order_relaxed),
+                    .errors = entry.errors.load(std::memory_order_relaxed),
+                    .total_construction_time = std::chrono::nanoseconds(
+                        entry.total_construction_time.load(std::memory_order_relaxed)),
+                    .max_construction_time = std::chrono::nanoseconds(
+                        entry.max_construction_time.load(std::memory_order_relaxed)),
+                });
+            }
+
+            return result;
+        }
+
+    private:
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] counters& get_counters(const type_key_pair& handle)
+        {
+            {
+                std::shared_lock lock(m_State->mutex);
+                auto iter = m_State->entries.find(handle);
+                if (iter != m_State->entries.end()) [[likely]]
+                {
+                    return iter->second;
+                }
+            }
+
+            std::unique_lock lock(m_State->mutex);
+            auto& entry = m_State->entries[handle];
+            entry.type_name = type_name<typename InjectableTy::value_type>();
+            return entry;
+        }
+
+        [[nodiscard]] static auto& construction_stack()
+        {
+            thread_local std::vector<clock_type::time_point> stack;
+            return stack;
+        }
+
+    private:
+        std::unique_ptr<state> m_State = std::make_unique<state>();
+    };
+
+    struct metrics_service_policy
+    {
+        using service_map_type = default_service_policy::service_map_type;
+        using observer_type = metrics_service_observer;
+    };
+    static_assert(service_policy_type<metrics_service_policy>,
+                  "metrics_service_policy is not a service_policy_type");
+
+    using metrics_service_collection = base_service_collection<metrics_service_policy>;
+    using metrics_service_provider = base_service_provider<metrics_service_policy,
+                                                           default_service_storage_memory_type,
+                                                           default_service_storage_memory_type>;
+    using metrics_service_scope = metrics_service_provider::scope_type;
+}
\ No newline at end of file
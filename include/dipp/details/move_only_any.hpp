@@ -1,9 +1,11 @@
 #pragma once
 
 #include <bit>
-#include <typeinfo>
+#include <cstddef>
+#include <cstring>
 #include <memory>
 #include "result.hpp"
+#include "type_id.hpp"
 
 namespace dipp::details
 {
@@ -88,7 +90,7 @@ namespace dipp::details
 
         struct storage
         {
-            const std::type_info* type_info{};
+            size_t type_id{};
             union
             {
                 trivial_storage trivial_type;
@@ -137,7 +139,7 @@ namespace dipp::details
 
         constexpr move_only_any(move_only_any&& other) noexcept
         {
-            m_Storage.type_info = other.m_Storage.type_info;
+            m_Storage.type_id = other.m_Storage.type_id;
             m_Storage.type = other.m_Storage.type;
             switch (m_Storage.type)
             {
@@ -167,7 +169,7 @@ namespace dipp::details
             if (this != &other)
             {
                 reset();
-                m_Storage.type_info = other.m_Storage.type_info;
+                m_Storage.type_id = other.m_Storage.type_id;
                 m_Storage.type = other.m_Storage.type;
                 switch (m_Storage.type)
                 {
@@ -207,6 +209,29 @@ namespace dipp::details
             return any;
         }
 
+        /// <summary>
+        /// Refers to a result owned elsewhere, such as a block of descriptors added in bulk,
+        /// instead of boxing it on the heap. The result must outlive the move_only_any, which never
+        /// destroys it.
+        /// </summary>
+        template<typename Ty>
+            requires(is_large<Ty>)
+        [[nodiscard]] static move_only_any make_external(result<Ty>& value) noexcept
+        {
+            move_only_any any;
+            any.m_Storage.type_id = type_id_v<Ty>;
+            any.m_Storage.u.large_type.data = std::addressof(value);
+            any.m_Storage.u.large_type.rtti.destruct = [](void*) {};
+            any.m_Storage.type = any_storage_type::large_type;
+            return any;
+        }
+
+        /// <summary>
+        /// Checks if a type is too large for the small buffer and is boxed on the heap.
+        /// </summary>
+        template<typename Ty>
+        static constexpr bool is_boxed_v = is_large<Ty>;
+
 #ifdef DIPP_USE_RESULT
         template<typename... Args>
         [[nodiscard]] static move_only_any make_error(error_id id)
@@ -241,25 +266,43 @@ namespace dipp::details
 
         template<typename Ty>
         [[nodiscard]] result<Ty>* cast() noexcept
+        {
+            if (holds(type_id_v<Ty>))
+            {
+                return unchecked_cast<Ty>();
+            }
+            return nullptr;
+        }
+
+        /// <summary>
+        /// Casts to the stored type without comparing type information, the caller must know the
+        /// stored type is Ty.
+        /// </summary>
+        template<typename Ty>
+        [[nodiscard]] result<Ty>* unchecked_cast() noexcept
         {
             using resulty_type = result<Ty>;
 
-            if (m_Storage.type_info == &typeid(Ty))
+            if constexpr (is_trivial<Ty>)
             {
-                if constexpr (is_trivial<Ty>)
-                {
-                    return std::bit_cast<resulty_type*>(&m_Storage.u.trivial_type.buffer);
-                }
-                else if constexpr (is_small<Ty>)
-                {
-                    return std::bit_cast<resulty_type*>(&m_Storage.u.small_type.buffer);
-                }
-                else
-                {
-                    return std::bit_cast<resulty_type*>(m_Storage.u.large_type.data);
-                }
+                return std::bit_cast<resulty_type*>(&m_Storage.u.trivial_type.buffer);
             }
-            return nullptr;
+            else if constexpr (is_small<Ty>)
+            {
+                return std::bit_cast<resulty_type*>(&m_Storage.u.small_type.buffer);
+            }
+            else
+            {
+                return std::bit_cast<resulty_type*>(m_Storage.u.large_type.data);
+            }
+        }
+
+        /// <summary>
+        /// Checks if the stored type has the specified type_id_v, without instantiating a cast.
+        /// </summary>
+        [[nodiscard]] constexpr bool holds(size_t typeId) const noexcept
+        {
+            return m_Storage.type_id == typeId;
         }
 
         [[nodiscard]] constexpr bool empty() const noexcept
@@ -267,6 +310,11 @@ namespace dipp::details
             return m_Storage.type == any_storage_type::null;
         }
 
+        [[nodiscard]] constexpr bool is_heap_allocated() const noexcept
+        {
+            return m_Storage.type == any_storage_type::large_type;
+        }
+
 #ifdef DIPP_USE_RESULT
         [[nodiscard]] error_id error() noexcept
         {
@@ -275,17 +323,20 @@ namespace dipp::details
 
         [[nodiscard]] constexpr bool has_error() const noexcept
         {
-            return m_Storage.type_info == &typeid(error_id);
+            return holds(type_id_v<error_id>);
         }
 #endif
 
-        [[nodiscard]] constexpr const std::type_info& type() const noexcept
+        /// <summary>
+        /// Gets the type_id_v of the stored type, or of void if empty.
+        /// </summary>
+        [[nodiscard]] constexpr size_t type() const noexcept
         {
             if (empty())
             {
-                return typeid(void);
+                return type_id_v<void>;
             }
-            return *m_Storage.type_info;
+            return m_Storage.type_id;
         }
 
         void swap(move_only_any& other) noexcept
@@ -300,7 +351,7 @@ namespace dipp::details
             using result_type = result<Ty>;
             using pointer_type = std::add_pointer_t<result_type>;
 
-            m_Storage.type_info = &typeid(Ty);
+            m_Storage.type_id = type_id_v<Ty>;
             if constexpr (is_trivial<Ty>)
             {
                 auto obj = std::bit_cast<pointer_type>(&m_Storage.u.trivial_type.buffer);
@@ -351,6 +402,18 @@ namespace dipp::details
                     new (ptr) result_type(std::forward<Args>(args)...);
                 }
             }
+            else if constexpr (std::is_constructible_v<result_type, std::in_place_t, Args...>)
+            {
+                // std::expected based results construct the value in place, without a temporary
+                if (std::is_constant_evaluated())
+                {
+                    std::construct_at(ptr, std::in_place, std::forward<Args>(args)...);
+                }
+                else
+                {
+                    new (ptr) result_type(std::in_place, std::forward<Args>(args)...);
+                }
+            }
             else
             {
                 if (std::is_constant_evaluated())
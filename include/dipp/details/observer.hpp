@@ -0,0 +1,52 @@
+#pragma once
+
+#include "concepts.hpp"
+#include "type_key_pair.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// Observer that ignores every resolution event, selected when the storage policy doesn't
+    /// define an observer_type. All callbacks are empty and inline away.
+    /// Every callback receives the injected type and the (service type, key) handle it was
+    /// registered with:
+    ///   on_lookup:          a service is requested from the storage.
+    ///   on_cache_hit:       a singleton/scoped instance was already constructed.
+    ///   on_construct_begin: the descriptor is about to construct a new instance.
+    ///   on_construct_end:   the construction finished, successfully or not.
+    ///   on_allocation:      the constructed instance was boxed on the heap by move_only_any.
+    ///   on_error:           the request failed, called before the error is returned or thrown.
+    /// </summary>
+    struct null_service_observer
+    {
+        template<base_injected_type InjectableTy>
+        constexpr void on_lookup(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_cache_hit(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_construct_begin(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_construct_end(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_allocation(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_error(const type_key_pair&) noexcept
+        {
+        }
+    };
+}
\ No newline at end of file
@@ -10,16 +10,38 @@
 
 #include "service_info.hpp"
 #include "instance_info.hpp"
+#include "observer.hpp"
 
 namespace dipp::details
 {
     struct default_service_policy
     {
         using service_map_type = std::map<type_key_pair, service_info>;
+        using observer_type = null_service_observer;
     };
     static_assert(service_policy_type<default_service_policy>,
                   "default_service_policy is not a service_policy_type");
 
+    /// <summary>
+    /// Selects the observer of a storage policy, policies without an observer_type use the
+    /// null_service_observer.
+    /// </summary>
+    template<service_policy_type PolicyTy>
+    struct service_policy_observer
+    {
+        using type = null_service_observer;
+    };
+
+    template<service_policy_type PolicyTy>
+        requires requires { typename PolicyTy::observer_type; }
+    struct service_policy_observer<PolicyTy>
+    {
+        using type = typename PolicyTy::observer_type;
+    };
+
+    template<service_policy_type PolicyTy>
+    using service_policy_observer_t = typename service_policy_observer<PolicyTy>::type;
+
     //
 
     struct default_service_storage_memory_type
@@ -90,14 +90,35 @@ namespace dipp::details
             return root_scope().template get<InjectableTy>();
         }
 
+        /// <summary>
+        /// Gets the service of the specified type registered with a key known at runtime from the
+        /// root scope.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] auto get(size_t key) -> result<InjectableTy>
+        {
+            return root_scope().template get<InjectableTy>(key);
+        }
+
+        /// <summary>
+        /// Gets all singleton or scoped services of the specified type from the root scope, cached
+        /// after the first call.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+            requires(InjectableTy::descriptor_type::lifetime != service_lifetime::transient)
+        [[nodiscard]] auto get_all() -> result<std::span<InjectableTy>>
+        {
+            return root_scope().template get_all<InjectableTy>();
+        }
+
     public:
         /// <summary>
         /// Checks if the service of the specified type is registered in the root scope.
         /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] bool has() const noexcept
+        [[nodiscard]] bool has(size_t key = InjectableTy::key) const noexcept
         {
-            return root_scope().template has<InjectableTy>();
+            return root_scope().template has<InjectableTy>(key);
         }
 
     public:
@@ -105,9 +126,9 @@ namespace dipp::details
         /// Counts the number of services of the specified type in the root scope.
         /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] size_t count() const noexcept
+        [[nodiscard]] size_t count(size_t key = InjectableTy::key) const noexcept
         {
-            return root_scope().template count<InjectableTy>();
+            return root_scope().template count<InjectableTy>(key);
         }
 
     public:
@@ -120,6 +141,15 @@ namespace dipp::details
             return root_scope().template count_all<InjectableTy>();
         }
 
+        /// <summary>
+        /// Gets the keys the service type is registered with.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] std::span<const size_t> keys_of() const noexcept
+        {
+            return root_scope().template keys_of<InjectableTy>();
+        }
+
     public:
         /// <summary>
         /// Finds all services from the storage with the specified type and key.
@@ -133,6 +163,78 @@ namespace dipp::details
             return root_scope().template find_all<InjectableTy>(std::forward<FnTy>(callback));
         }
 
+        /// <summary>
+        /// Finds all services from the storage with the specified type, whatever their key.
+        /// </summary>
+        template<base_injected_type InjectableTy, typename FnTy>
+            requires std::is_invocable_v<
+                FnTy,
+                size_t,
+                base_service_getter<InjectableTy, singleton_storage_type, scoped_storage_type>>
+        void find_all_keys(FnTy&& callback)
+        {
+            return root_scope().template find_all_keys<InjectableTy>(
+                std::forward<FnTy>(callback));
+        }
+
+    public:
+        /// <summary>
+        /// Returns the observer notified of every resolution made through this provider.
+        /// </summary>
+        [[nodiscard]] auto& observer() noexcept
+        {
+            return m_Storage.observer();
+        }
+
+        /// <summary>
+        /// Returns the observer notified of every resolution made through this provider.
+        /// </summary>
+        [[nodiscard]] auto& observer() const noexcept
+        {
+            return m_Storage.observer();
+        }
+
+        /// <summary>
+        /// Returns a snapshot of the metrics collected by the observer, only available if the
+        /// observer collects metrics.
+        /// Example: for (auto& metrics : provider.metrics_snapshot()) { export(metrics); }
+        /// </summary>
+        [[nodiscard]] auto metrics_snapshot() const
+            requires requires(const storage_type& storage) { storage.observer().snapshot(); }
+        {
+            return m_Storage.observer().snapshot();
+        }
+
+    public:
+        /// <summary>
+        /// Validates the registrations once at startup, missing dependencies, mismatched
+        /// descriptors and cycles are reported as errors. On success, resolutions skip their
+        /// per-call compatibility checks.
+        /// Example: services.validate();
+        /// </summary>
+        auto validate() -> result<bool>
+        {
+            return m_Storage.validate();
+        }
+
+        /// <summary>
+        /// Checks if the provider passed validation and resolves in unchecked mode.
+        /// </summary>
+        [[nodiscard]] bool is_validated() const noexcept
+        {
+            return m_Storage.is_validated();
+        }
+
+    public:
+        /// <summary>
+        /// Builds the dependency graph of the services this provider was built with.
+        /// Example: std::cout << provider.export_graph().to_json();
+        /// </summary>
+        [[nodiscard]] service_graph export_graph() const
+        {
+            return service_graph(m_Storage.metadata());
+        }
+
     private:
         singleton_storage_type m_SingletonStorage;
         storage_type m_Storage;
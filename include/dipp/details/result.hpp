@@ -2,7 +2,102 @@
 
 #include <type_traits>
 
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED) && !defined(DIPP_USE_RESULT)
+    #error "DIPP_USE_EXPECTED selects the error type of DIPP_USE_RESULT, define both"
+#endif
+
+#if defined(DIPP_USE_EXPECTED)
+    #include <version>
+    #if !defined(__cpp_lib_expected)
+        #error "DIPP_USE_EXPECTED requires std::expected, build with C++23 (--cpp-version=c++23)"
+    #endif
+
+    #include <expected>
+
+    #include "type_id.hpp"
+    #include "errors/base_error.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// Compact error carried by results in the std::expected mode. It is trivially copyable, so
+    /// returning an error never allocates: the type_id_v of the error and the name of the service
+    /// it refers to, which points to the static storage of type_name<Ty>().
+    /// </summary>
+    struct error_code
+    {
+        size_t Type{};
+        const char* TypeName{};
+
+        /// <summary>
+        /// Checks if the error was created from an error of the specified type.
+        /// </summary>
+        template<typename ErrorTy>
+        [[nodiscard]] bool is() const noexcept
+        {
+            return Type == type_id_v<ErrorTy>;
+        }
+    };
+    static_assert(std::is_trivially_copyable_v<error_code>,
+                  "error_code must be trivially copyable");
+
+    using error_id = error_code;
+
+    /// <summary>
+    /// std::expected with the result interface used by dipp, errors convert implicitly to any
+    /// result as they do with boost::leaf::result.
+    /// </summary>
+    template<typename Ty>
+    class result : public std::expected<Ty, error_id>
+    {
+    private:
+        using base_type = std::expected<Ty, error_id>;
+
+    public:
+        using base_type::base_type;
+
+        constexpr result(error_id error) noexcept
+            : base_type(std::unexpect, error)
+        {
+        }
+
+        [[nodiscard]]
+        constexpr bool has_error() const noexcept
+        {
+            return !this->has_value();
+        }
+    };
+
+    template<typename Ty, typename... Args>
+    inline result<Ty> make_result(Args&&... args)
+    {
+        if constexpr (std::is_constructible_v<result<Ty>, Args...>)
+        {
+            return result<Ty>(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return result<Ty>(std::in_place, std::forward<Args>(args)...);
+        }
+    }
+
+    template<typename Error>
+    inline error_id make_error(const Error& error) noexcept
+    {
+        if constexpr (std::is_base_of_v<base_error, Error>)
+        {
+            return error_id{type_id_v<Error>, error.TypeName};
+        }
+        else
+        {
+            return error_id{type_id_v<Error>, nullptr};
+        }
+    }
+}
+
+    #define DIPP_RETURN_ERROR(x) return dipp::details::make_error(x)
+
+#elif defined(DIPP_USE_RESULT)
     #include <boost/leaf.hpp>
 
 namespace dipp::details
@@ -15,7 +110,14 @@ namespace dipp::details
     template<typename Ty, typename... Args>
     inline result<Ty> make_result(Args&&... args)
     {
-        return result<Ty>(std::forward<Args>(args)...);
+        if constexpr (std::is_constructible_v<result<Ty>, Args...>)
+        {
+            return result<Ty>(std::forward<Args>(args)...);
+        }
+        else
+        {
+            return result<Ty>(Ty(std::forward<Args>(args)...));
+        }
     }
 
     template<typename Error>
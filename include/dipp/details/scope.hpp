@@ -1,11 +1,39 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <span>
+#include <vector>
+
 #include "storage.hpp"
 #include "policy.hpp"
 #include "string_hash.hpp"
 
 namespace dipp::details
 {
+    /// <summary>
+    /// Services resolved by get_all, cached by their scope.
+    /// </summary>
+    class base_cached_services
+    {
+    public:
+        virtual ~base_cached_services() = default;
+    };
+
+    template<base_injected_type InjectableTy>
+    class cached_services final : public base_cached_services
+    {
+    public:
+        std::vector<InjectableTy> services;
+    };
+
+    /// <summary>
+    /// Identifies the cached services of an injected type by address, a shared library with its
+    /// own copy only fills its own entry of the cache.
+    /// </summary>
+    template<base_injected_type InjectableTy>
+    inline constexpr char cached_services_tag = 0;
+
     template<service_policy_type StoragePolicyTy,
              service_storage_memory_type SingletonPolicyTy,
              service_storage_memory_type ScopedPolicyTy>
@@ -29,6 +57,7 @@ namespace dipp::details
             : m_Storage(storage)
             , m_SingletonStorage(singleton_storage)
             , m_LocalStorage(std::move(scope.m_LocalStorage))
+            , m_CachedServices(std::move(scope.m_CachedServices))
         {
         }
 
@@ -42,13 +71,70 @@ namespace dipp::details
 
     public:
         /// <summary>
-        /// Get a service from the storage.
+        /// Get a service from the storage, or every registration of the service for all_of.
         /// </summary>
         template<base_injected_type InjectableTy>
         [[nodiscard]] auto get() -> result<InjectableTy>
+        {
+            if constexpr (is_all_of_v<InjectableTy>)
+            {
+                auto services =
+                    m_Storage->template get_all_services<typename InjectableTy::injected_type>(
+                        *this, *m_SingletonStorage, m_LocalStorage);
+#ifdef DIPP_USE_RESULT
+                if (services.has_error()) [[unlikely]]
+                {
+                    return services.error();
+                }
+#endif
+                return make_result<InjectableTy>(std::move(*services));
+            }
+            else
+            {
+                return m_Storage->template get_service<InjectableTy>(
+                    *this, *m_SingletonStorage, m_LocalStorage);
+            }
+        }
+
+        /// <summary>
+        /// Get a service from the storage with a key known at runtime, such as a tenant id.
+        /// Example: auto db = scope.get<TenantDbService>(tenant_id);
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] auto get(size_t key) -> result<InjectableTy>
         {
             return m_Storage->template get_service<InjectableTy>(
-                *this, *m_SingletonStorage, m_LocalStorage);
+                *this, *m_SingletonStorage, m_LocalStorage, key);
+        }
+
+        /// <summary>
+        /// Gets all singleton or scoped services with the specified type and key, in registration
+        /// order. They are resolved on the first call and cached by the scope, later calls return
+        /// the same contiguous instances without any lookup. A failed resolution is not cached.
+        /// Example: for (auto& handler : *scope.get_all<HandlerService>()) { ... }
+        /// </summary>
+        template<base_injected_type InjectableTy>
+            requires(InjectableTy::descriptor_type::lifetime != service_lifetime::transient)
+        [[nodiscard]] auto get_all() -> result<std::span<InjectableTy>>
+        {
+            auto& cache = m_CachedServices[&cached_services_tag<InjectableTy>];
+            if (!cache)
+            {
+                auto services = m_Storage->template get_all_services<InjectableTy>(
+                    *this, *m_SingletonStorage, m_LocalStorage);
+#ifdef DIPP_USE_RESULT
+                if (services.has_error()) [[unlikely]]
+                {
+                    return services.error();
+                }
+#endif
+                auto cached = std::make_unique<cached_services<InjectableTy>>();
+                cached->services = std::move(*services);
+                cache = std::move(cached);
+            }
+
+            auto& services = static_cast<cached_services<InjectableTy>&>(*cache).services;
+            return make_result<std::span<InjectableTy>>(services);
         }
 
     public:
@@ -56,9 +142,9 @@ namespace dipp::details
         /// Check if a service is registered in the storage.
         /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] bool has() const noexcept
+        [[nodiscard]] bool has(size_t key = InjectableTy::key) const noexcept
         {
-            return m_Storage->template has_service<InjectableTy>();
+            return m_Storage->template has_service<InjectableTy>(key);
         }
 
     public:
@@ -66,9 +152,9 @@ namespace dipp::details
         /// Count the number of services registered in the storage.
         /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] size_t count() const noexcept
+        [[nodiscard]] size_t count(size_t key = InjectableTy::key) const noexcept
         {
-            return m_Storage->template count<InjectableTy>();
+            return m_Storage->template count<InjectableTy>(key);
         }
 
     public:
@@ -81,6 +167,15 @@ namespace dipp::details
             return m_Storage->template count_all<InjectableTy>();
         }
 
+        /// <summary>
+        /// Gets the keys the service type is registered with.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] std::span<const size_t> keys_of() const noexcept
+        {
+            return m_Storage->template keys_of<InjectableTy>();
+        }
+
     public:
         /// <summary>
         /// Finds all services from the storage with the specified type and key.
@@ -95,10 +190,26 @@ namespace dipp::details
                 *this, std::forward<FnTy>(callback), *m_SingletonStorage, m_LocalStorage);
         }
 
+        /// <summary>
+        /// Finds all services from the storage with the specified type, whatever their key.
+        /// Example: scope.find_all_keys<HandlerService>([](size_t key, auto getter) { ... });
+        /// </summary>
+        template<base_injected_type InjectableTy, typename FnTy>
+            requires std::is_invocable_v<
+                FnTy,
+                size_t,
+                base_service_getter<InjectableTy, singleton_storage_type, scoped_storage_type>>
+        void find_all_keys(FnTy&& callback)
+        {
+            return m_Storage->template find_all_keys<InjectableTy>(
+                *this, std::forward<FnTy>(callback), *m_SingletonStorage, m_LocalStorage);
+        }
+
     private:
         storage_type* m_Storage;
         singleton_storage_type* m_SingletonStorage;
         scoped_storage_type m_LocalStorage;
+        std::map<const void*, std::unique_ptr<base_cached_services>> m_CachedServices;
     };
 
     using service_scope = base_service_scope<default_service_policy,
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <span>
+
+#include "concepts.hpp"
+#include "dependency.hpp"
+#include "type_id.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// A dependency declared by a registered service.
+    /// </summary>
+    struct service_dependency_info
+    {
+        type_key_pair handle{};
+        const char* type_name{};
+        size_t descriptor_type{};
+        // false for all_of, which is satisfied by no registration at all
+        bool required = true;
+    };
+
+    /// <summary>
+    /// Type information retained for every registration, once the descriptor is boxed in a
+    /// move_only_any this is the only way to inspect it.
+    /// </summary>
+    struct service_metadata
+    {
+        type_key_pair handle{};
+        const char* type_name{};
+        size_t descriptor_type{};
+        service_lifetime lifetime{};
+        std::span<const service_dependency_info> dependencies;
+    };
+
+    /// <summary>
+    /// Gets the dependencies declared by a descriptor, built once per descriptor type.
+    /// </summary>
+    template<service_descriptor_type DescTy>
+    [[nodiscard]] std::span<const service_dependency_info> get_descriptor_dependencies()
+    {
+        if constexpr (requires { typename DescTy::dependency_type::types; })
+        {
+            static const auto dependencies = []<typename... DepsTy>(std::tuple<DepsTy...>*)
+            {
+                return std::array<service_dependency_info, sizeof...(DepsTy)>{
+                    service_dependency_info{
+                        make_type_key(type_id_v<typename DepsTy::descriptor_type::service_type>,
+                                      DepsTy::key),
+                        type_name<typename DepsTy::descriptor_type::value_type>(),
+                        type_id_v<typename DepsTy::descriptor_type>,
+                        !is_all_of_v<DepsTy>}...};
+            }(static_cast<typename DescTy::dependency_type::types*>(nullptr));
+            return dependencies;
+        }
+        else
+        {
+            return {};
+        }
+    }
+
+    /// <summary>
+    /// Creates the metadata of a descriptor registered with the specified key.
+    /// </summary>
+    template<service_descriptor_type DescTy>
+    [[nodiscard]] service_metadata make_service_metadata(size_t key)
+    {
+        return service_metadata{
+            .handle = make_type_key(type_id_v<typename DescTy::service_type>, key),
+            .type_name = type_name<typename DescTy::value_type>(),
+            .descriptor_type = type_id_v<DescTy>,
+            .lifetime = DescTy::lifetime,
+            .dependencies = get_descriptor_dependencies<DescTy>(),
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <type_traits>
+
+#include "concepts.hpp"
+#include "type_id.hpp"
+#include "type_key_pair.hpp"
+#include "observer.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// Resolution events forwarded to the observer by the type-erased resolution core.
+    /// </summary>
+    enum class service_event : unsigned char
+    {
+        lookup,
+        cache_hit,
+        construct_begin,
+        construct_end,
+        allocation,
+        error
+    };
+
+    /// <summary>
+    /// The type information of an injected service, used by the resolution core so that the
+    /// lookup, caching and error paths are compiled once per policy instead of once per service.
+    /// </summary>
+    template<typename ObserverTy>
+    struct service_vtable
+    {
+        size_t descriptor_type;
+        size_t value_type;
+        const char* (*service_type_name)() noexcept;
+
+        // forwards an event to the observer's templated callbacks, null for null_service_observer
+        void (*notify)(ObserverTy& observer, service_event event, const type_key_pair& handle);
+
+        void on_event(ObserverTy& observer, service_event event, const type_key_pair& handle) const
+        {
+            if constexpr (!std::is_same_v<ObserverTy, null_service_observer>)
+            {
+                notify(observer, event, handle);
+            }
+        }
+    };
+
+    /// <summary>
+    /// Calls the observer's callback for the event with the injected type.
+    /// </summary>
+    template<base_injected_type InjectableTy, typename ObserverTy>
+    void notify_service_event(ObserverTy& observer,
+                              service_event event,
+                              const type_key_pair& handle)
+    {
+        switch (event)
+        {
+            case service_event::lookup:
+                observer.template on_lookup<InjectableTy>(handle);
+                break;
+            case service_event::cache_hit:
+                observer.template on_cache_hit<InjectableTy>(handle);
+                break;
+            case service_event::construct_begin:
+                observer.template on_construct_begin<InjectableTy>(handle);
+                break;
+            case service_event::construct_end:
+                observer.template on_construct_end<InjectableTy>(handle);
+                break;
+            case service_event::allocation:
+                observer.template on_allocation<InjectableTy>(handle);
+                break;
+            case service_event::error:
+                observer.template on_error<InjectableTy>(handle);
+                break;
+        }
+    }
+
+    template<base_injected_type InjectableTy, typename ObserverTy>
+    [[nodiscard]] consteval auto get_service_event_notifier() noexcept
+    {
+        using notify_type = void (*)(ObserverTy&, service_event, const type_key_pair&);
+        if constexpr (std::is_same_v<ObserverTy, null_service_observer>)
+        {
+            return notify_type{};
+        }
+        else
+        {
+            return notify_type{&notify_service_event<InjectableTy, ObserverTy>};
+        }
+    }
+
+    template<base_injected_type InjectableTy, typename ObserverTy>
+    inline constexpr service_vtable<ObserverTy> service_vtable_v{
+        type_id_v<typename InjectableTy::descriptor_type>,
+        type_id_v<typename InjectableTy::descriptor_type::value_type>,
+        &type_name<typename InjectableTy::descriptor_type::service_type>,
+        get_service_event_notifier<InjectableTy, ObserverTy>()};
+
+    /// <summary>
+    /// Reports the beginning of a construction to the observer, and its end once the guard goes out
+    /// of scope so that constructions unwound by an exception are still closed.
+    /// </summary>
+    template<typename ObserverTy>
+    class observed_construction
+    {
+    public:
+        observed_construction(ObserverTy& observer,
+                              const service_vtable<ObserverTy>& vtable,
+                              const type_key_pair& handle)
+            : m_Observer(observer)
+            , m_VTable(vtable)
+            , m_Handle(handle)
+        {
+            m_VTable.on_event(m_Observer, service_event::construct_begin, m_Handle);
+        }
+
+        observed_construction(const observed_construction&) = delete;
+        observed_construction& operator=(const observed_construction&) = delete;
+
+        ~observed_construction()
+        {
+            m_VTable.on_event(m_Observer, service_event::construct_end, m_Handle);
+        }
+
+    private:
+        ObserverTy& m_Observer;
+        const service_vtable<ObserverTy>& m_VTable;
+        const type_key_pair& m_Handle;
+    };
+}
\ No newline at end of file
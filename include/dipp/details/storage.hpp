@@ -1,16 +1,46 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
 #include "loader.hpp"
 #include "getter.hpp"
+#include "graph.hpp"
+#include "service_metadata.hpp"
+#include "string_hash.hpp"
+
+#include "errors/circular_dependency.hpp"
 
 namespace dipp::details
 {
+    /// <summary>
+    /// Descriptors added in bulk, stored contiguously and referred to by their registrations.
+    /// </summary>
+    class base_descriptor_block
+    {
+    public:
+        virtual ~base_descriptor_block() = default;
+    };
+
+    template<service_descriptor_type DescTy>
+    class descriptor_block final : public base_descriptor_block
+    {
+    public:
+        std::vector<result<DescTy>> descriptors;
+    };
+
     template<service_policy_type PolicyTy>
     class base_service_storage
     {
     public:
         using policy_type = PolicyTy;
         using service_map_type = typename policy_type::service_map_type;
+        using observer_type = service_policy_observer_t<policy_type>;
 
     public:
         /// <summary>
@@ -19,6 +49,10 @@ namespace dipp::details
         void clear() noexcept
         {
             m_Descriptors.clear();
+            m_Keys.clear();
+            m_Metadata.clear();
+            m_Blocks.clear();
+            m_Validated = false;
         }
 
         /// <summary>
@@ -27,13 +61,18 @@ namespace dipp::details
         template<service_descriptor_type DescTy>
         void clear(size_t key)
         {
-            auto service_type = typeid(typename DescTy::service_type).hash_code();
+            auto service_type = type_id_v<typename DescTy::service_type>;
             auto handle = make_type_key(service_type, key);
             auto iter = m_Descriptors.find(handle);
 
             if (iter != m_Descriptors.end())
             {
                 m_Descriptors.erase(iter);
+                remove_key(service_type, key);
+                std::erase_if(m_Metadata,
+                              [&](const service_metadata& metadata)
+                              { return metadata.handle == handle; });
+                m_Validated = false;
             }
         }
 
@@ -43,18 +82,27 @@ namespace dipp::details
         template<service_descriptor_type DescTy>
         void clear_all()
         {
-            auto service_type = typeid(typename DescTy::service_type).hash_code();
-            for (auto iter = m_Descriptors.begin(); iter != m_Descriptors.end();)
+            auto service_type = type_id_v<typename DescTy::service_type>;
+            auto keys = m_Keys.find(service_type);
+            if (keys == m_Keys.end())
             {
-                if (iter->first.first == service_type)
-                {
-                    iter = m_Descriptors.erase(iter);
-                }
-                else
+                return;
+            }
+
+            for (size_t key : keys->second)
+            {
+                auto iter = m_Descriptors.find(make_type_key(service_type, key));
+                if (iter != m_Descriptors.end())
                 {
-                    ++iter;
+                    m_Descriptors.erase(iter);
                 }
             }
+            m_Keys.erase(keys);
+
+            std::erase_if(m_Metadata,
+                          [&](const service_metadata& metadata)
+                          { return metadata.handle.first == service_type; });
+            m_Validated = false;
         }
 
     public:
@@ -64,11 +112,152 @@ namespace dipp::details
         template<service_descriptor_type DescTy>
         void add_service(DescTy&& descriptor, size_t key)
         {
-            auto service_type = typeid(typename DescTy::service_type).hash_code();
+            assert((key == size_t{} || !key_registry::collides(key)) &&
+                   "service added with a key hashed from two different strings");
+
+            auto service_type = type_id_v<typename DescTy::service_type>;
             auto service_handle = make_type_key(service_type, key);
 
-            m_Descriptors[service_handle].emplace_back(
-                move_only_any::make<DescTy>(std::forward<DescTy>(descriptor)));
+            auto& services = m_Descriptors[service_handle];
+            if (services.empty())
+            {
+                m_Keys[service_type].push_back(key);
+            }
+            services.emplace_back(move_only_any::make<DescTy>(std::forward<DescTy>(descriptor)));
+            m_Metadata.emplace_back(make_service_metadata<std::remove_cvref_t<DescTy>>(key));
+            m_Validated = false;
+        }
+
+        /// <summary>
+        /// Adds services in bulk from a range of (descriptor, key) pairs of one descriptor type, in
+        /// the same order as add_service would. Descriptors boxed on the heap share a single block,
+        /// and the registrations are sorted once to be inserted next to each other. Descriptors
+        /// are moved out of a range passed as an rvalue.
+        /// </summary>
+        template<service_registration_range_type RangeTy>
+        void add_services(RangeTy&& registrations)
+        {
+            using descriptor_type = std::remove_cvref_t<
+                decltype(std::get<0>(*std::ranges::begin(registrations)))>;
+            constexpr bool is_boxed = move_only_any::is_boxed_v<descriptor_type>;
+
+            std::vector<size_t> keys;
+            std::vector<move_only_any> services;
+            std::unique_ptr<descriptor_block<descriptor_type>> block;
+            if constexpr (is_boxed)
+            {
+                block = std::make_unique<descriptor_block<descriptor_type>>();
+            }
+
+            if constexpr (std::ranges::sized_range<RangeTy>)
+            {
+                keys.reserve(std::ranges::size(registrations));
+                services.reserve(std::ranges::size(registrations));
+                if constexpr (is_boxed)
+                {
+                    block->descriptors.reserve(std::ranges::size(registrations));
+                }
+            }
+
+            for (auto&& registration : registrations)
+            {
+                auto& descriptor = std::get<0>(registration);
+                size_t key = std::get<1>(registration);
+                assert((key == size_t{} || !key_registry::collides(key)) &&
+                       "service added with a key hashed from two different strings");
+
+                keys.push_back(key);
+                if constexpr (is_boxed)
+                {
+                    if constexpr (std::is_lvalue_reference_v<RangeTy>)
+                    {
+                        block->descriptors.emplace_back(descriptor);
+                    }
+                    else
+                    {
+                        block->descriptors.emplace_back(std::move(descriptor));
+                    }
+                }
+                else if constexpr (std::is_lvalue_reference_v<RangeTy>)
+                {
+                    services.emplace_back(move_only_any::make<descriptor_type>(descriptor));
+                }
+                else
+                {
+                    services.emplace_back(
+                        move_only_any::make<descriptor_type>(std::move(descriptor)));
+                }
+            }
+
+            if (keys.empty())
+            {
+                return;
+            }
+
+            if constexpr (is_boxed)
+            {
+                for (auto& descriptor : block->descriptors)
+                {
+                    services.emplace_back(
+                        move_only_any::make_external<descriptor_type>(descriptor));
+                }
+                m_Blocks.emplace_back(std::move(block));
+            }
+
+            // every registration shares the service type, so sorting by key sorts by handle
+            std::vector<size_t> order(keys.size());
+            std::iota(order.begin(), order.end(), size_t{});
+            if (!std::ranges::is_sorted(keys))
+            {
+                std::ranges::stable_sort(order, {}, [&](size_t index) { return keys[index]; });
+            }
+
+            auto service_type = type_id_v<typename descriptor_type::service_type>;
+            std::vector<bool> new_keys(keys.size());
+
+            auto hint = m_Descriptors.end();
+            for (size_t first = 0; first < order.size();)
+            {
+                size_t key = keys[order[first]];
+                size_t last = first;
+                while (last < order.size() && keys[order[last]] == key)
+                {
+                    ++last;
+                }
+
+                auto iter = m_Descriptors.try_emplace(hint, make_type_key(service_type, key));
+                if (iter->second.empty())
+                {
+                    new_keys[order[first]] = true;
+                }
+
+                iter->second.reserve(iter->second.size() + (last - first));
+                for (; first < last; ++first)
+                {
+                    iter->second.emplace_back(std::move(services[order[first]]));
+                }
+                hint = std::next(iter);
+            }
+
+            auto& service_keys = m_Keys[service_type];
+            m_Metadata.reserve(m_Metadata.size() + keys.size());
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                if (new_keys[i])
+                {
+                    service_keys.push_back(keys[i]);
+                }
+                m_Metadata.emplace_back(make_service_metadata<descriptor_type>(keys[i]));
+            }
+            m_Validated = false;
+        }
+
+        /// <summary>
+        /// Reserves room for the metadata of the specified number of registrations.
+        /// </summary>
+        void reserve(size_t count)
+        {
+            m_Metadata.reserve(count);
         }
 
     public:
@@ -78,7 +267,10 @@ namespace dipp::details
         template<service_descriptor_type DescTy>
         bool emplace_service(DescTy&& descriptor, size_t key)
         {
-            auto service_type = typeid(typename DescTy::service_type).hash_code();
+            assert((key == size_t{} || !key_registry::collides(key)) &&
+                   "service added with a key hashed from two different strings");
+
+            auto service_type = type_id_v<typename DescTy::service_type>;
 
             auto service_handle = make_type_key(service_type, key);
             auto iter = m_Descriptors.find(service_handle);
@@ -87,8 +279,11 @@ namespace dipp::details
                 return false;
             }
 
+            m_Keys[service_type].push_back(key);
             m_Descriptors[service_handle].emplace_back(
                 move_only_any::make<DescTy>(std::forward<DescTy>(descriptor)));
+            m_Metadata.emplace_back(make_service_metadata<std::remove_cvref_t<DescTy>>(key));
+            m_Validated = false;
             return true;
         }
 
@@ -103,23 +298,48 @@ namespace dipp::details
         [[nodiscard]] auto get_service(ScopeTy& scope,
                                        SingletonMemTy& singleton_storage,
                                        ScopedMemTy& scoped_storage) -> result<InjectableTy>
+        {
+            return get_service<InjectableTy>(
+                scope, singleton_storage, scoped_storage, InjectableTy::key);
+        }
+
+        /// <summary>
+        /// Gets a service from the storage with a key known at runtime instead of the key of the
+        /// injected type.
+        /// </summary>
+        template<base_injected_type InjectableTy,
+                 service_scope_type ScopeTy,
+                 service_storage_memory_type SingletonMemTy,
+                 service_storage_memory_type ScopedMemTy>
+        [[nodiscard]] auto get_service(ScopeTy& scope,
+                                       SingletonMemTy& singleton_storage,
+                                       ScopedMemTy& scoped_storage,
+                                       size_t key) -> result<InjectableTy>
         {
             using descriptor_type = typename InjectableTy::descriptor_type;
             using service_type = typename descriptor_type::service_type;
 
-            auto service_handle = typeid(service_type).hash_code();
-            auto handle = make_type_key(service_handle, InjectableTy::key);
-            auto it = m_Descriptors.find(handle);
+            auto service_handle = type_id_v<service_type>;
+            auto handle = make_type_key(service_handle, key);
+            m_Observer.template on_lookup<InjectableTy>(handle);
 
-            if (it == m_Descriptors.end()) [[unlikely]]
+            service_loader loader{
+                scope, singleton_storage, scoped_storage, m_Observer, m_Validated};
+            return loader.template load<InjectableTy>(handle, find_service(handle));
+        }
+
+    private:
+        /// <summary>
+        /// Finds the last service registered with the handle, or null if there is none.
+        /// </summary>
+        [[nodiscard]] move_only_any* find_service(const type_key_pair& handle)
+        {
+            auto it = m_Descriptors.find(handle);
+            if (it == m_Descriptors.end() || it->second.empty()) [[unlikely]]
             {
-                DIPP_RETURN_ERROR(service_not_found::error<service_type>());
+                return nullptr;
             }
-
-            auto& last_service = it->second.back();
-
-            service_loader loader{scope, singleton_storage, scoped_storage};
-            return loader.load<InjectableTy>(last_service);
+            return std::addressof(it->second.back());
         }
 
     public:
@@ -127,14 +347,13 @@ namespace dipp::details
         /// Checks if a service with the specified key exists in the storage.
         /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] bool has_service() const noexcept
+        [[nodiscard]] bool has_service(size_t key = InjectableTy::key) const noexcept
         {
             using descriptor_type = typename InjectableTy::descriptor_type;
-            using value_type = typename descriptor_type::value_type;
             using service_type = typename descriptor_type::service_type;
 
-            auto service_handle = typeid(service_type).hash_code();
-            auto handle = make_type_key(service_handle, InjectableTy::key);
+            auto service_handle = type_id_v<service_type>;
+            auto handle = make_type_key(service_handle, key);
 
             return m_Descriptors.find(handle) != m_Descriptors.end();
         }
@@ -144,13 +363,13 @@ namespace dipp::details
         /// Counts the number of services with the specified key in the storage.
         /// </summary>
         template<base_injected_type InjectableTy>
-        [[nodiscard]] size_t count() const noexcept
+        [[nodiscard]] size_t count(size_t key = InjectableTy::key) const noexcept
         {
             using descriptor_type = typename InjectableTy::descriptor_type;
             using service_type = typename descriptor_type::service_type;
 
-            auto service_handle = typeid(service_type).hash_code();
-            auto handle = make_type_key(service_handle, InjectableTy::key);
+            auto service_handle = type_id_v<service_type>;
+            auto handle = make_type_key(service_handle, key);
             auto it = m_Descriptors.find(handle);
 
             return it != m_Descriptors.end() ? it->second.size() : 0;
@@ -165,20 +384,38 @@ namespace dipp::details
             using descriptor_type = typename InjectableTy::descriptor_type;
             using service_type = typename descriptor_type::service_type;
 
-            auto service_handle = typeid(service_type).hash_code();
+            auto service_handle = type_id_v<service_type>;
             size_t count = 0;
 
-            for (auto iter = m_Descriptors.begin(); iter != m_Descriptors.end(); ++iter)
+            for (size_t key : keys_of<InjectableTy>())
             {
-                if (iter->first.first == service_handle)
+                auto it = m_Descriptors.find(make_type_key(service_handle, key));
+                if (it != m_Descriptors.end())
                 {
-                    count += iter->second.size();
+                    count += it->second.size();
                 }
             }
 
             return count;
         }
 
+        /// <summary>
+        /// Gets the keys the service type is registered with, in registration order. The span is
+        /// invalidated by the next registration or removal.
+        /// </summary>
+        template<base_injected_type InjectableTy>
+        [[nodiscard]] std::span<const size_t> keys_of() const noexcept
+        {
+            using service_type = typename InjectableTy::descriptor_type::service_type;
+
+            auto keys = m_Keys.find(type_id_v<service_type>);
+            if (keys == m_Keys.end())
+            {
+                return {};
+            }
+            return keys->second;
+        }
+
     public:
         /// <summary>
         /// Finds all services from the storage with the specified type and key.
@@ -199,8 +436,10 @@ namespace dipp::details
             using service_getter_type =
                 base_service_getter<InjectableTy, SingletonMemTy, ScopedMemTy>;
 
-            auto service_handle = typeid(service_type).hash_code();
+            auto service_handle = type_id_v<service_type>;
             auto handle = make_type_key(service_handle, InjectableTy::key);
+            m_Observer.template on_lookup<InjectableTy>(handle);
+
             auto it = m_Descriptors.find(handle);
 
             if (it == m_Descriptors.end())
@@ -208,15 +447,219 @@ namespace dipp::details
                 return;
             }
 
-            service_loader loader{scope, singleton_storage, scoped_storage};
+            service_loader loader{
+                scope, singleton_storage, scoped_storage, m_Observer, m_Validated};
             for (auto& service : it->second)
             {
-                service_getter_type getter{loader, service};
+                service_getter_type getter{loader, handle, service};
                 callback(getter);
             }
         }
 
+        /// <summary>
+        /// Resolves all services from the storage with the specified type and key, in registration
+        /// order, with a single lookup. Stops at the first service that fails to resolve.
+        /// </summary>
+        template<base_injected_type InjectableTy,
+                 service_storage_memory_type SingletonMemTy,
+                 service_storage_memory_type ScopedMemTy>
+        [[nodiscard]] auto get_all_services(
+            typename InjectableTy::descriptor_type::scope_type& scope,
+            SingletonMemTy& singleton_storage,
+            ScopedMemTy& scoped_storage) -> result<std::vector<InjectableTy>>
+        {
+            using descriptor_type = typename InjectableTy::descriptor_type;
+            using service_type = typename descriptor_type::service_type;
+
+            auto service_handle = type_id_v<service_type>;
+            auto handle = make_type_key(service_handle, InjectableTy::key);
+            m_Observer.template on_lookup<InjectableTy>(handle);
+
+            std::vector<InjectableTy> services;
+
+            auto it = m_Descriptors.find(handle);
+            if (it == m_Descriptors.end())
+            {
+                return make_result<std::vector<InjectableTy>>(std::move(services));
+            }
+
+            services.reserve(it->second.size());
+
+            service_loader loader{
+                scope, singleton_storage, scoped_storage, m_Observer, m_Validated};
+            for (auto& service : it->second)
+            {
+                auto instance = loader.template load<InjectableTy>(handle, service);
+#ifdef DIPP_USE_RESULT
+                if (instance.has_error()) [[unlikely]]
+                {
+                    return instance.error();
+                }
+#endif
+                services.emplace_back(std::move(*instance));
+            }
+
+            return make_result<std::vector<InjectableTy>>(std::move(services));
+        }
+
+        /// <summary>
+        /// Finds all services from the storage with the specified type, whatever their key. The
+        /// callback receives the key of each registration and its getter.
+        /// </summary>
+        template<base_injected_type InjectableTy,
+                 typename FnTy,
+                 service_storage_memory_type SingletonMemTy,
+                 service_storage_memory_type ScopedMemTy>
+            requires std::is_invocable_v<
+                FnTy,
+                size_t,
+                base_service_getter<InjectableTy, SingletonMemTy, ScopedMemTy>>
+        void find_all_keys(typename InjectableTy::descriptor_type::scope_type& scope,
+                           FnTy&& callback,
+                           SingletonMemTy& singleton_storage,
+                           ScopedMemTy& scoped_storage)
+        {
+            using descriptor_type = typename InjectableTy::descriptor_type;
+            using service_type = typename descriptor_type::service_type;
+            using service_getter_type =
+                base_service_getter<InjectableTy, SingletonMemTy, ScopedMemTy>;
+
+            auto service_handle = type_id_v<service_type>;
+            service_loader loader{
+                scope, singleton_storage, scoped_storage, m_Observer, m_Validated};
+
+            for (size_t key : keys_of<InjectableTy>())
+            {
+                auto handle = make_type_key(service_handle, key);
+                m_Observer.template on_lookup<InjectableTy>(handle);
+
+                auto it = m_Descriptors.find(handle);
+                if (it == m_Descriptors.end())
+                {
+                    continue;
+                }
+
+                for (auto& service : it->second)
+                {
+                    service_getter_type getter{loader, handle, service};
+                    callback(key, getter);
+                }
+            }
+        }
+
+    public:
+        /// <summary>
+        /// Checks that every declared dependency is registered with the descriptor its consumer
+        /// expects, that all registrations of a service share one descriptor and that there are no
+        /// cycles. On success, resolutions skip their per-call compatibility checks until the next
+        /// registration; factories returning move_only_any must still produce the declared type.
+        /// </summary>
+        auto validate() -> result<bool>
+        {
+            std::map<type_key_pair, size_t> descriptor_types;
+            for (auto& metadata : m_Metadata)
+            {
+                auto [iter, inserted] =
+                    descriptor_types.try_emplace(metadata.handle, metadata.descriptor_type);
+                if (!inserted && iter->second != metadata.descriptor_type) [[unlikely]]
+                {
+                    DIPP_RETURN_ERROR(incompatible_service_descriptor::error(metadata.type_name));
+                }
+            }
+
+            service_graph graph(m_Metadata);
+            for (auto& node : graph.nodes())
+            {
+                if (node.in_cycle) [[unlikely]]
+                {
+                    DIPP_RETURN_ERROR(circular_dependency::error(node.type_name));
+                }
+            }
+
+            for (auto& metadata : m_Metadata)
+            {
+                for (auto& dependency : metadata.dependencies)
+                {
+                    auto iter = descriptor_types.find(dependency.handle);
+                    if (iter == descriptor_types.end()) [[unlikely]]
+                    {
+                        if (!dependency.required)
+                        {
+                            continue;
+                        }
+                        DIPP_RETURN_ERROR(service_not_found::error(dependency.type_name));
+                    }
+                    if (iter->second != dependency.descriptor_type) [[unlikely]]
+                    {
+                        DIPP_RETURN_ERROR(
+                            incompatible_service_descriptor::error(dependency.type_name));
+                    }
+                }
+            }
+
+            m_Validated = true;
+            return make_result<bool>(true);
+        }
+
+        /// <summary>
+        /// Checks if the storage passed validation since its last registration.
+        /// </summary>
+        [[nodiscard]] bool is_validated() const noexcept
+        {
+            return m_Validated;
+        }
+
+    public:
+        /// <summary>
+        /// Gets the metadata of every registration, in registration order.
+        /// </summary>
+        [[nodiscard]] const auto& metadata() const noexcept
+        {
+            return m_Metadata;
+        }
+
+    public:
+        /// <summary>
+        /// Gets the observer notified of every resolution.
+        /// </summary>
+        [[nodiscard]] auto& observer() noexcept
+        {
+            return m_Observer;
+        }
+
+        /// <summary>
+        /// Gets the observer notified of every resolution.
+        /// </summary>
+        [[nodiscard]] auto& observer() const noexcept
+        {
+            return m_Observer;
+        }
+
+    private:
+        /// <summary>
+        /// Removes a key from the keys of its service type, once its last registration is gone.
+        /// </summary>
+        void remove_key(size_t service_type, size_t key)
+        {
+            auto keys = m_Keys.find(service_type);
+            if (keys != m_Keys.end())
+            {
+                std::erase(keys->second, key);
+                if (keys->second.empty())
+                {
+                    m_Keys.erase(keys);
+                }
+            }
+        }
+
     private:
         service_map_type m_Descriptors;
+        // the keys every service type is registered with, so that the operations over all keys of a
+        // type do not scan every registration
+        std::map<size_t, std::vector<size_t>> m_Keys;
+        std::vector<service_metadata> m_Metadata;
+        std::vector<std::unique_ptr<base_descriptor_block>> m_Blocks;
+        bool m_Validated = false;
+        [[no_unique_address]] observer_type m_Observer;
     };
 }
\ No newline at end of file
@@ -1,9 +1,71 @@
 #pragma once
 
 #include <string_view>
+#include <type_traits>
+#ifndef NDEBUG
+    #include <mutex>
+    #include <string>
+    #include <unordered_map>
+    #include <unordered_set>
+#endif
+
+#include "type_id.hpp"
 
 namespace dipp::details
 {
+#ifndef NDEBUG
+    /// <summary>
+    /// Debug builds record the strings hashed into keys at runtime, so that two different strings
+    /// hashing to the same key are detected when a service is added with it. Keys computed at
+    /// compile time, such as the ones of injected types, cannot be recorded.
+    /// </summary>
+    class key_registry
+    {
+    public:
+        /// <summary>
+        /// Records the string a key was computed from, returns false if another string was already
+        /// recorded for the same key.
+        /// </summary>
+        static bool record(std::string_view str, size_t key)
+        {
+            auto& registry = get();
+            std::scoped_lock lock(registry.mutex);
+
+            auto [iter, inserted] = registry.strings.try_emplace(key, str);
+            if (!inserted && iter->second != str)
+            {
+                registry.collisions.insert(key);
+                return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Checks if different strings were recorded for the key.
+        /// </summary>
+        [[nodiscard]] static bool collides(size_t key)
+        {
+            auto& registry = get();
+            std::scoped_lock lock(registry.mutex);
+            return registry.collisions.contains(key);
+        }
+
+    private:
+        struct state
+        {
+            std::mutex mutex;
+            std::unordered_map<size_t, std::string> strings;
+            std::unordered_set<size_t> collisions;
+        };
+
+        static state& get()
+        {
+            static state registry;
+            return registry;
+        }
+    };
+#endif
+
     struct string_hash
     {
         constexpr string_hash() noexcept
@@ -14,6 +76,12 @@ namespace dipp::details
         constexpr string_hash(std::string_view str)
             : value(compute_hash(str))
         {
+#ifndef NDEBUG
+            if (!std::is_constant_evaluated())
+            {
+                key_registry::record(str, value);
+            }
+#endif
         }
 
         constexpr operator size_t() const noexcept
@@ -26,19 +94,14 @@ namespace dipp::details
     private:
         static constexpr size_t compute_hash(std::string_view str) noexcept
         {
-            size_t hash = 0;
-            for (char c : str)
-            {
-                hash = hash * 31 + static_cast<size_t>(c);
-            }
-            return hash;
+            return static_cast<size_t>(fnv1a_hash(str));
         }
     };
 
     /// <summary>
     /// Generates a hash key from a string literal or std::string_view.
     /// </summary>
-    static constexpr size_t key(const char* str) noexcept
+    constexpr size_t key(const char* str) noexcept
     {
         return string_hash(str).value;
     }
@@ -46,7 +109,7 @@ namespace dipp::details
     /// <summary>
     /// Generates a hash key from a std::string_view.
     /// </summary>
-    static constexpr size_t key(const std::string_view& str) noexcept
+    constexpr size_t key(const std::string_view& str) noexcept
     {
         return string_hash(str).value;
     }
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "collection.hpp"
+#include "provider.hpp"
+#include "type_id.hpp"
+
+namespace dipp::details
+{
+    /// <summary>
+    /// A single resolution span recorded by the trace observer.
+    /// </summary>
+    struct service_trace_event
+    {
+        const char* type_name{};
+        size_t key{};
+        service_lifetime lifetime{};
+        bool failed{};
+
+        size_t thread_id{};
+        std::chrono::nanoseconds start{};
+        std::chrono::nanoseconds duration{};
+    };
+
+    /// <summary>
+    /// Observer recording every construction as a span, nested constructions (dependencies built
+    /// through apply) are recorded inside the span of the service that requested them.
+    /// The spans can be written as Chrome trace-event JSON, readable by chrome://tracing and
+    /// Perfetto.
+    /// </summary>
+    class trace_service_observer
+    {
+    private:
+        using clock_type = std::chrono::steady_clock;
+
+        struct open_span
+        {
+            clock_type::time_point start;
+            bool failed{};
+        };
+
+        struct state
+        {
+            clock_type::time_point origin = clock_type::now();
+
+            std::mutex mutex;
+            std::vector<service_trace_event> events;
+        };
+
+    public:
+        template<base_injected_type InjectableTy>
+        constexpr void on_lookup(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_cache_hit(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_construct_begin(const type_key_pair&)
+        {
+            open_spans().push_back({clock_type::now()});
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_construct_end(const type_key_pair& handle)
+        {
+            auto& spans = open_spans();
+            auto span = spans.back();
+            spans.pop_back();
+
+            service_trace_event event{
+                .type_name = type_name<typename InjectableTy::value_type>(),
+                .key = handle.second,
+                .lifetime = InjectableTy::descriptor_type::lifetime,
+                .failed = span.failed,
+                .thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id()),
+                .start = span.start - m_State->origin,
+                .duration = clock_type::now() - span.start,
+            };
+
+            std::scoped_lock lock(m_State->mutex);
+            m_State->events.push_back(event);
+        }
+
+        template<base_injected_type InjectableTy>
+        constexpr void on_allocation(const type_key_pair&) noexcept
+        {
+        }
+
+        template<base_injected_type InjectableTy>
+        void on_error(const type_key_pair&)
+        {
+            auto& spans = open_spans();
+            if (!spans.empty())
+            {
+                spans.back().failed = true;
+            }
+        }
+
+    public:
+        /// <summary>
+        /// Copies the spans recorded so far.
+        /// </summary>
+        [[nodiscard]] std::vector<service_trace_event> events() const
+        {
+            std::scoped_lock lock(m_State->mutex);
+            return m_State->events;
+        }
+
+        /// <summary>
+        /// Writes the recorded spans as Chrome trace-event JSON.
+        /// </summary>
+        void write_chrome_trace(std::ostream& stream) const
+        {
+            auto recorded = events();
+
+            stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+            for (size_t i = 0; i < recorded.size(); i++)
+            {
+                auto& event = recorded[i];
+                if (i != 0)
+                {
+                    stream << ',';
+                }
+
+                stream << "{\"name\":\"";
+                write_escaped(stream, event.type_name);
+                stream << "\",\"cat\":\"dipp\",\"ph\":\"X\",\"pid\":0"
+                       << ",\"tid\":" << event.thread_id
+                       << ",\"ts\":" << to_microseconds(event.start)
+                       << ",\"dur\":" << to_microseconds(event.duration)
+                       << ",\"args\":{\"key\":" << event.key << ",\"lifetime\":\""
+                       << lifetime_name(event.lifetime) << "\",\"failed\":"
+                       << (event.failed ? "true" : "false") << "}}";
+            }
+            stream << "]}";
+        }
+
+        /// <summary>
+        /// Writes the recorded spans as Chrome trace-event JSON to a file.
+        /// Returns false if the file could not be written.
+        /// </summary>
+        bool write_chrome_trace(const char* path) const
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return false;
+            }
+
+            write_chrome_trace(file);
+            return static_cast<bool>(file);
+        }
+
+    private:
+        [[nodiscard]] static auto& open_spans()
+        {
+            thread_local std::vector<open_span> spans;
+            return spans;
+        }
+
+        [[nodiscard]] static double to_microseconds(std::chrono::nanoseconds duration) noexcept
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+
+        [[nodiscard]] static const char* lifetime_name(service_lifetime lifetime) noexcept
+        {
+            switch (lifetime)
+            {
+                case service_lifetime::singleton:
+                    return "singleton";
+                case service_lifetime::scoped:
+                    return "scoped";
+                case service_lifetime::transient:
+                    return "transient";
+            }
+            return "unknown";
+        }
+
+        static void write_escaped(std::ostream& stream, std::string_view text)
+        {
+            for (char c : text)
+            {
+                switch (c)
+                {
+                    case '"':
+                        stream << "\\\"";
+                        break;
+                    case '\\':
+                        stream << "\\\\";
+                        break;
+                    default:
+                        stream << c;
+                        break;
+                }
+            }
+        }
+
+    private:
+        std::unique_ptr<state> m_State = std::make_unique<state>();
+    };
+
+    struct trace_service_policy
+    {
+        using service_map_type = default_service_policy::service_map_type;
+        using observer_type = trace_service_observer;
+    };
+    static_assert(service_policy_type<trace_service_policy>,
+                  "trace_service_policy is not a service_policy_type");
+
+    using trace_service_collection = base_service_collection<trace_service_policy>;
+    using trace_service_provider = base_service_provider<trace_service_policy,
+                                                         default_service_storage_memory_type,
+                                                         default_service_storage_memory_type>;
+    using trace_service_scope = trace_service_provider::scope_type;
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#if !defined(DIPP_NO_RTTI) && !defined(__cpp_rtti) && !defined(__GXX_RTTI) && !defined(_CPPRTTI)
+    #define DIPP_NO_RTTI
+#endif
+
+#ifndef DIPP_NO_RTTI
+    #include <typeinfo>
+#endif
+
+namespace dipp::details
+{
+    /// <summary>
+    /// 64-bit FNV-1a hash of a string, usable at compile time.
+    /// </summary>
+    [[nodiscard]] constexpr std::uint64_t fnv1a_hash(std::string_view str) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : str)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /// <summary>
+    /// Gets the compiler's signature of this function for the type, which spells out the type's
+    /// fully qualified name.
+    /// </summary>
+    template<typename Ty>
+    [[nodiscard]] consteval std::string_view type_signature() noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+
+    /// <summary>
+    /// Identifier of a type, computed at compile time from its name so that it is the same in every
+    /// shared library, unlike the address of its type_info or its hash_code. Like typeid, it
+    /// ignores references and cv-qualifiers. Types in anonymous namespaces of different
+    /// translation units that share a name also share an identifier. Specialized for the types
+    /// whose names nest the whole dependency graph, see dependency.hpp.
+    /// </summary>
+    template<typename Ty>
+    struct type_id_of
+    {
+        static constexpr size_t value = static_cast<size_t>(fnv1a_hash(type_signature<Ty>()));
+    };
+
+    template<typename Ty>
+    inline constexpr size_t type_id_v = type_id_of<std::remove_cvref_t<Ty>>::value;
+
+    /// <summary>
+    /// Combines identifiers, for the types specializing type_id_of to compute their identifier from
+    /// their template arguments rather than from their name.
+    /// </summary>
+    template<std::same_as<size_t>... IdsTy>
+    [[nodiscard]] constexpr size_t combine_type_ids(size_t seed, IdsTy... ids) noexcept
+    {
+        // splitmix64 finalizer, so that close identifiers such as keys spread over every bit
+        auto mix = [](std::uint64_t value)
+        {
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+            return value ^ (value >> 31);
+        };
+
+        std::uint64_t hash = seed;
+        ((hash = mix(hash ^ (ids + 0x9e3779b97f4a7c15ull))), ...);
+        return static_cast<size_t>(hash);
+    }
+
+    /// <summary>
+    /// Extracts the name of the type from its signature, using the position of a known type in
+    /// the signature of that type.
+    /// </summary>
+    template<typename Ty>
+    [[nodiscard]] consteval std::string_view type_name_view() noexcept
+    {
+        constexpr std::string_view probe_name = "double";
+        constexpr std::string_view probe_signature = type_signature<double>();
+        constexpr size_t prefix = probe_signature.find(probe_name);
+        constexpr size_t suffix = probe_signature.size() - prefix - probe_name.size();
+
+        constexpr std::string_view signature = type_signature<Ty>();
+        return signature.substr(prefix, signature.size() - prefix - suffix);
+    }
+
+    template<typename Ty>
+    struct constexpr_type_name
+    {
+        static constexpr auto value = []
+        {
+            constexpr std::string_view name = type_name_view<Ty>();
+            std::array<char, name.size() + 1> str{};
+            for (size_t i = 0; i < name.size(); ++i)
+            {
+                str[i] = name[i];
+            }
+            return str;
+        }();
+    };
+
+    /// <summary>
+    /// Gets the name of a type, as returned by typeid(Ty).name() or, when RTTI is disabled, as
+    /// spelled by the compiler at compile time. The name points to static storage.
+    /// </summary>
+    template<typename Ty>
+    [[nodiscard]] inline const char* type_name() noexcept
+    {
+#ifdef DIPP_NO_RTTI
+        return constexpr_type_name<std::remove_cvref_t<Ty>>::value.data();
+#else
+        return typeid(Ty).name();
+#endif
+    }
+}
\ No newline at end of file
@@ -3,8 +3,11 @@
 #include "details/descriptors.hpp"
 #include "details/collection.hpp"
 #include "details/provider.hpp"
+#include "details/dense_index.hpp"
 #include "details/injected.hpp"
 #include "details/apply.hpp"
+#include "details/metrics.hpp"
+#include "details/trace.hpp"
 
 namespace dipp
 {
@@ -18,13 +21,38 @@ namespace dipp
     using details::service_lifetime;
     using details::service_provider;
     using details::service_scope;
+    using details::dense_service_index;
+
+    using details::default_service_policy;
+    using details::default_service_storage_memory_type;
+    using details::null_service_observer;
+
+    using details::metrics_service_collection;
+    using details::metrics_service_observer;
+    using details::metrics_service_policy;
+    using details::metrics_service_provider;
+    using details::metrics_service_scope;
+    using details::service_metrics;
+
+    using details::service_dependency_info;
+    using details::service_graph;
+    using details::service_graph_node;
+    using details::service_metadata;
+    using details::service_trace_event;
+    using details::trace_service_collection;
+    using details::trace_service_observer;
+    using details::trace_service_policy;
+    using details::trace_service_provider;
+    using details::trace_service_scope;
 
     using details::apply;
     using details::key;
     using details::make_any;
     using details::make_error;
     using details::make_result;
+    using details::type_name;
 
+    using details::all_of;
     using details::base_service_descriptor;
     using details::dependency;
     using details::functor_service_descriptor;
@@ -37,11 +65,17 @@ namespace dipp
     using details::injected_functor;
     using details::injected_ref;
     using details::injected_shared;
+    using details::injected_shared_ref;
     using details::injected_unique;
     using details::result;
 
     using details::base_error;
+    using details::circular_dependency;
     using details::incompatible_service_descriptor;
     using details::mismatched_service_type;
     using details::service_not_found;
+
+#ifdef DIPP_USE_EXPECTED
+    using details::error_code;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+module;
+
+// Every header dipp depends on is included in the global module fragment first, so that the
+// include in the export block below only attaches dipp's own declarations to the module. Keep this
+// list in sync with the includes of include/dipp.
+#include <algorithm>
+#include <any>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if defined(DIPP_USE_EXPECTED)
+    #include <expected>
+    #include <version>
+#elif defined(DIPP_USE_RESULT)
+    #include <boost/leaf.hpp>
+#endif
+
+export module dipp;
+
+export
+{
+#include "dipp/dipp.hpp"
+}
\ No newline at end of file
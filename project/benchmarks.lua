@@ -1,18 +1,22 @@
 -- opts:
 --  opts.name: the project test name
 --  opts.path: the path to the test files
+--  opts.comparison: whether the benchmark compares dipp with fruit and kangaru
 local function add_benchamrk(opts)
     local file_path = os.projectdir() .. "/benchmarks/" .. opts.path
     target(opts.name)
         set_group("benchmarks")
         set_kind("binary")
         add_deps("dipp")
+        add_deps("dipp_support")
 
         add_packages("boost")
         add_packages("benchmark")
-        
-        add_packages("kangaru")
-        add_packages("fruit")
+
+        if opts.comparison then
+            add_packages("kangaru")
+            add_packages("fruit")
+        end
 
         add_files(file_path .. "/**.cpp")
         add_headerfiles(file_path .. "/**.hpp")
@@ -21,4 +25,54 @@ local function add_benchamrk(opts)
     target_end()
 end
 
-add_benchamrk({name = "benchmark_basic_services", path = "basic_services"})
\ No newline at end of file
+if is_config("benchmark-comparison", true) then
+    add_benchamrk({name = "benchmark_basic_services", path = "basic_services", comparison = true})
+end
+
+add_benchamrk({name = "benchmark_dipp_services", path = "dipp_services"})
+add_benchamrk({name = "benchmark_wide_dependencies", path = "wide_dependencies"})
+add_benchamrk({name = "benchmark_shared_ref", path = "shared_ref"})
+add_benchamrk({name = "benchmark_scopes", path = "scopes"})
+add_benchamrk({name = "benchmark_transients", path = "transients"})
+add_benchamrk({name = "benchmark_keys", path = "keys"})
+add_benchamrk({name = "benchmark_graphs", path = "graphs"})
+add_benchamrk({name = "benchmark_large_registry", path = "large_registry"})
+add_benchamrk({name = "benchmark_concurrency", path = "concurrency"})
+add_benchamrk({name = "benchmark_allocations", path = "allocations"})
+add_benchamrk({name = "benchmark_move_only_any", path = "move_only_any"})
+
+-- Compiles generated service graphs, reporting compile time, peak compiler memory and code size
+-- Usage: xmake run benchmark_compile_time [--services 0 100 400] [--depth 8] [--fan-out 3]
+target("benchmark_compile_time")
+    set_group("benchmarks")
+    set_kind("phony")
+
+    add_extrafiles(os.projectdir() .. "/benchmarks/compile_time/*.py")
+
+    on_run(function (target)
+        import("core.base.option")
+        import("core.project.config")
+
+        local script = path.join(os.projectdir(), "benchmarks", "compile_time", "measure.py")
+        local output = path.join(config.buildir(), "compile_time.json")
+        local arguments = table.wrap(option.get("arguments"))
+        os.execv("python3", table.join({script, "--json", output}, arguments))
+    end)
+target_end()
+
+-- Compiles the tests including dipp/dipp.hpp and importing the dipp module
+-- Usage: xmake run benchmark_module_build [--cxx clang++] [--tests keys scoping]
+target("benchmark_module_build")
+    set_group("benchmarks")
+    set_kind("phony")
+
+    on_run(function (target)
+        import("core.base.option")
+        import("core.project.config")
+
+        local script = path.join(os.projectdir(), "benchmarks", "compile_time", "measure_modules.py")
+        local output = path.join(config.buildir(), "module_build.json")
+        local arguments = table.wrap(option.get("arguments"))
+        os.execv("python3", table.join({script, "--json", output}, arguments))
+    end)
+target_end()
\ No newline at end of file
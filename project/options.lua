@@ -8,10 +8,25 @@ option("benchmark")
     set_description("Enable benchmark support")
 option_end()
 
+option("benchmark-comparison")
+    set_default(true)
+    set_description("Build the benchmarks comparing dipp with fruit and kangaru")
+option_end()
+
+option("modules")
+    set_default(false)
+    set_description("Build the dipp C++20 module interface, imported with `import dipp;`")
+option_end()
+
+option("rtti")
+    set_default(true)
+    set_description("Build with RTTI, without it dipp uses compile-time type names")
+option_end()
+
 option("error-type")
     set_default("result")
     set_description("Set the error handling type")
-    set_values("result", "exceptions")
+    set_values("result", "exceptions", "expected")
 option_end()
 
 option("cpp-version")
@@ -1,8 +1,10 @@
 local function install_benchmark_packages()
     if is_config("benchmark", true) then
         add_requires("benchmark")
-        add_requires("kangaru")
-        add_requires("fruit")
+        if is_config("benchmark-comparison", true) then
+            add_requires("kangaru")
+            add_requires("fruit")
+        end
     end
 end
 
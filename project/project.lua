@@ -10,5 +10,22 @@ target("dipp")
 
     if is_config("error-type", "result") then
         add_defines("DIPP_USE_RESULT", {public = true})
+    elseif is_config("error-type", "expected") then
+        -- the result code paths with std::expected<T, dipp::error_code> instead of boost::leaf
+        add_defines("DIPP_USE_RESULT", "DIPP_USE_EXPECTED", {public = true})
     end
 target_end()
+
+
+-- The headers exported as a named module, see modules/dipp.cppm
+if is_config("modules", true) then
+    target("dipp_module")
+        set_kind("static")
+        set_policy("build.c++.modules", true)
+
+        add_deps("dipp", {public = true})
+        add_files(os.projectdir() .. "/modules/dipp.cppm", {public = true})
+
+        add_filegroups("dipp", {rootdir = os.projectdir()})
+    target_end()
+end
\ No newline at end of file
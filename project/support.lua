@@ -0,0 +1,9 @@
+-- Instrumentation shared by the tests and benchmarks, such as allocation counting
+target("dipp_support")
+    set_kind("headeronly")
+
+    add_headerfiles(os.projectdir() .. "/support/(**.hpp)")
+    add_includedirs(os.projectdir() .. "/support", {public = true})
+
+    add_filegroups("support", {rootdir = os.projectdir() .. "/support"})
+target_end()
\ No newline at end of file
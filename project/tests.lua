@@ -1,17 +1,46 @@
+-- opts:
+--  opts.name: the plugin target name
+--  opts.file: the plugin source file
+local function add_test_plugin(opts)
+    target(opts.name)
+        set_group("tests")
+        set_kind("shared")
+        set_symbols("hidden")
+
+        add_deps("dipp")
+        add_defines("DIPP_TEST_PLUGIN_EXPORT")
+
+        add_files(opts.file)
+    target_end()
+end
+
 -- opts:
 --  opts.name: the project test name
 --  opts.path: the path to the test files
 local function add_test(opts)
     local file_path = os.projectdir() .. "/tests/" .. opts.path
+
+    -- the sources in plugins/ are built as shared libraries loaded by the test
+    local plugins = {}
+    for _, file in ipairs(os.files(file_path .. "/plugins/*.cpp")) do
+        local plugin_name = opts.name .. "_" .. path.basename(file)
+        add_test_plugin({name = plugin_name, file = file})
+        table.insert(plugins, plugin_name)
+    end
+
     target(opts.name)
         set_group("tests")
         set_kind("binary")
         add_tests("default")
 
         add_deps("dipp")
+        add_deps("dipp_support")
         add_packages("boost")
+        for _, plugin in ipairs(plugins) do
+            add_deps(plugin)
+        end
 
-        add_files(file_path .. "/**.cpp")
+        add_files(file_path .. "/**.cpp|plugins/*.cpp")
         add_headerfiles(file_path .. "/**.hpp")
 
         add_filegroups(opts.name, {rootdir = file_path})
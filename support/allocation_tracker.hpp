@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions to count every heap allocation made by the calling
+// thread. Replacement functions cannot be inline, include this header from exactly one translation
+// unit per test or benchmark binary.
+
+namespace dipp::support
+{
+    struct allocation_counts
+    {
+        size_t allocations = 0;
+        size_t deallocations = 0;
+        size_t bytes = 0;
+
+        [[nodiscard]] constexpr allocation_counts operator-(
+            const allocation_counts& other) const noexcept
+        {
+            return {allocations - other.allocations,
+                    deallocations - other.deallocations,
+                    bytes - other.bytes};
+        }
+    };
+
+    namespace details
+    {
+        inline thread_local allocation_counts thread_allocations;
+
+        inline void* allocate(size_t size, size_t alignment)
+        {
+            if (size == 0)
+            {
+                size = 1;
+            }
+
+            void* ptr;
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                ptr = std::malloc(size);
+            }
+            else
+            {
+#ifdef _MSC_VER
+                ptr = _aligned_malloc(size, alignment);
+#else
+                // aligned_alloc requires the size to be a multiple of the alignment
+                ptr = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+            }
+
+            if (!ptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            thread_allocations.allocations++;
+            thread_allocations.bytes += size;
+            return ptr;
+        }
+
+        inline void deallocate(void* ptr, size_t alignment) noexcept
+        {
+            if (!ptr)
+            {
+                return;
+            }
+
+            thread_allocations.deallocations++;
+#ifdef _MSC_VER
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            {
+                _aligned_free(ptr);
+                return;
+            }
+#else
+            (void) alignment;
+#endif
+            std::free(ptr);
+        }
+    }
+
+    /// <summary>
+    /// Gets the allocations made by the calling thread so far.
+    /// </summary>
+    [[nodiscard]] inline allocation_counts current_allocations() noexcept
+    {
+        return details::thread_allocations;
+    }
+
+    /// <summary>
+    /// Counts the allocations made by the calling thread while invoking the function.
+    /// Example: auto counts = count_allocations([&] { (void) services.get<MyService>(); });
+    /// </summary>
+    template<typename FnTy>
+    [[nodiscard]] allocation_counts count_allocations(FnTy&& fn)
+    {
+        auto start = current_allocations();
+        fn();
+        return current_allocations() - start;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return dipp::support::details::allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size)
+{
+    return dipp::support::details::allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return dipp::support::details::allocate(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return dipp::support::details::allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    dipp::support::details::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    dipp::support::details::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    dipp::support::details::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    dipp::support::details::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept
+{
+    dipp::support::details::deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept
+{
+    dipp::support::details::deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    dipp::support::details::deallocate(ptr, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    dipp::support::details::deallocate(ptr, static_cast<size_t>(alignment));
+}
\ No newline at end of file
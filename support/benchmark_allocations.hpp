@@ -0,0 +1,69 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include "allocation_tracker.hpp"
+
+namespace dipp::support
+{
+    /// <summary>
+    /// Reports the allocations made by the benchmark loop as allocs/op and bytes/op counters.
+    /// Construct it right before the loop, the counters are set once the loop is done. Setup done
+    /// while the timing is paused should be excluded with pause() and resume() as well.
+    /// Example:
+    ///   benchmark_allocations allocations(state);
+    ///   for (auto _ : state) { ... }
+    /// </summary>
+    class benchmark_allocations
+    {
+    public:
+        explicit benchmark_allocations(benchmark::State& state) noexcept
+            : m_State(state)
+            , m_Start(current_allocations())
+        {
+        }
+
+        benchmark_allocations(const benchmark_allocations&) = delete;
+        benchmark_allocations& operator=(const benchmark_allocations&) = delete;
+
+        benchmark_allocations(benchmark_allocations&&) = delete;
+        benchmark_allocations& operator=(benchmark_allocations&&) = delete;
+
+        ~benchmark_allocations()
+        {
+            auto counts = current_allocations() - m_Start - m_Excluded;
+
+            // summed over the benchmark threads, then divided by the total iterations
+            m_State.counters["allocs/op"] =
+                benchmark::Counter(static_cast<double>(counts.allocations),
+                                   benchmark::Counter::kAvgIterations);
+            m_State.counters["bytes/op"] = benchmark::Counter(static_cast<double>(counts.bytes),
+                                                              benchmark::Counter::kAvgIterations);
+        }
+
+    public:
+        /// <summary>
+        /// Stops counting, along with state.PauseTiming().
+        /// </summary>
+        void pause() noexcept
+        {
+            m_Paused = current_allocations();
+        }
+
+        /// <summary>
+        /// Resumes counting, along with state.ResumeTiming().
+        /// </summary>
+        void resume() noexcept
+        {
+            auto excluded = current_allocations() - m_Paused;
+            m_Excluded.allocations += excluded.allocations;
+            m_Excluded.deallocations += excluded.deallocations;
+            m_Excluded.bytes += excluded.bytes;
+        }
+
+    private:
+        benchmark::State& m_State;
+        allocation_counts m_Start;
+        allocation_counts m_Paused;
+        allocation_counts m_Excluded;
+    };
+}
\ No newline at end of file
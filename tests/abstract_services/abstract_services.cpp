@@ -122,25 +122,31 @@ BOOST_AUTO_TEST_CASE(GivenCameraServices_WhenAddingToCollection_ThenCamerasAreCr
     auto camera_count = services.count<CameraService>();
     BOOST_CHECK_EQUAL(camera_count, 3);
 
+    int perspective_count = 0;
+    int orthographic_count = 0;
+
     services.find_all<CameraService>(
-        [](dipp::service_getter<CameraService> serviceGetter)
+        [&](dipp::service_getter<CameraService> serviceGetter)
         {
             std::unique_ptr<ICamera> camera = std::move(*serviceGetter());
-            BOOST_CHECK_NE(camera.get(), nullptr);
+            BOOST_REQUIRE_NE(camera.get(), nullptr);
 
-            if (dynamic_cast<PerspectiveCamera*>(camera.get()))
-            {
-                BOOST_CHECK_EQUAL(camera->projection(), 1);
-            }
-            else if (dynamic_cast<OrthographicCamera*>(camera.get()))
-            {
-                BOOST_CHECK_EQUAL(camera->projection(), 2);
-            }
-            else
+            switch (camera->projection())
             {
-                BOOST_CHECK(false);
+                case 1:
+                    ++perspective_count;
+                    break;
+                case 2:
+                    ++orthographic_count;
+                    break;
+                default:
+                    BOOST_CHECK(false);
+                    break;
             }
         });
+
+    BOOST_CHECK_EQUAL(perspective_count, 1);
+    BOOST_CHECK_EQUAL(orthographic_count, 2);
 }
 
 BOOST_AUTO_TEST_CASE(
@@ -192,7 +198,10 @@ BOOST_AUTO_TEST_CASE(
     services.find_all<DependecyCameraService>(
         [](dipp::service_getter<DependecyCameraService> cameraService)
         {
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+            auto service = cameraService();
+            BOOST_CHECK(service.error().is<dipp::service_not_found>());
+#elif defined(DIPP_USE_RESULT)
             bool found_service_not_found_error = false;
             boost::leaf::try_handle_some(
                 [&]() -> boost::leaf::result<void>
@@ -212,4 +221,86 @@ BOOST_AUTO_TEST_CASE(
         });
 }
 
+BOOST_AUTO_TEST_CASE(GivenSingletonCameraServices_WhenGettingAll_ThenCamerasAreCachedInOrder)
+{
+    using singleton_service = dipp::injected_unique< //
+        ICamera,
+        dipp::service_lifetime::singleton>;
+
+    // Given
+    dipp::service_collection collection;
+
+    collection.add_impl<singleton_service, PerspectiveCamera>();
+    collection.add_impl<singleton_service, OrthographicCamera>();
+    collection.add_impl<singleton_service, OrthographicCamera>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    std::span<singleton_service> first_cameras = *services.get_all<singleton_service>();
+    std::span<singleton_service> second_cameras = *services.get_all<singleton_service>();
+
+    // Then
+    BOOST_REQUIRE_EQUAL(first_cameras.size(), 3);
+
+    std::vector<ICamera*> cameras(first_cameras.begin(), first_cameras.end());
+    BOOST_CHECK_EQUAL(cameras[0]->projection(), 1);
+    BOOST_CHECK_EQUAL(cameras[1]->projection(), 2);
+    BOOST_CHECK_EQUAL(cameras[2]->projection(), 2);
+    BOOST_CHECK_NE(cameras[1], cameras[2]);
+
+    BOOST_CHECK_EQUAL(first_cameras.data(), second_cameras.data());
+    BOOST_CHECK_EQUAL(second_cameras.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenScopedCameraServices_WhenGettingAllFromScopes_ThenEachScopeHasItsOwn)
+{
+    using scoped_service = dipp::injected_unique< //
+        ICamera,
+        dipp::service_lifetime::scoped>;
+
+    // Given
+    dipp::service_collection collection;
+
+    collection.add_impl<scoped_service, PerspectiveCamera>();
+    collection.add_impl<scoped_service, OrthographicCamera>();
+
+    dipp::service_provider services(std::move(collection));
+
+    auto first_scope = services.create_scope();
+    auto second_scope = services.create_scope();
+
+    // When
+    std::span<scoped_service> first_cameras = *first_scope.get_all<scoped_service>();
+    std::span<scoped_service> second_cameras = *second_scope.get_all<scoped_service>();
+
+    // Then
+    BOOST_REQUIRE_EQUAL(first_cameras.size(), 2);
+    BOOST_REQUIRE_EQUAL(second_cameras.size(), 2);
+
+    ICamera* first_camera = first_cameras[1];
+    ICamera* second_camera = second_cameras[1];
+    ICamera* resolved_camera = *first_scope.get<scoped_service>();
+    BOOST_CHECK_NE(first_camera, second_camera);
+    BOOST_CHECK_EQUAL(first_camera, resolved_camera);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNoCameraServices_WhenGettingAll_ThenSpanIsEmpty)
+{
+    using singleton_service = dipp::injected_unique< //
+        ICamera,
+        dipp::service_lifetime::singleton>;
+
+    // Given
+    dipp::service_collection collection;
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    std::span<singleton_service> cameras = *services.get_all<singleton_service>();
+
+    // Then
+    BOOST_CHECK(cameras.empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
+
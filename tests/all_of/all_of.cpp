@@ -0,0 +1,160 @@
+#define BOOST_TEST_MODULE AllOf_Test
+
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(AllOf_Test)
+
+class IHandler
+{
+public:
+    virtual ~IHandler() = default;
+
+    virtual int id() const = 0;
+};
+
+class AuditHandler : public IHandler
+{
+public:
+    int id() const override
+    {
+        return 1;
+    }
+};
+
+class MetricsHandler : public IHandler
+{
+public:
+    int id() const override
+    {
+        return 2;
+    }
+};
+
+using HandlerService = dipp::injected_unique< //
+    IHandler,
+    dipp::service_lifetime::singleton>;
+
+using TransientHandlerService = dipp::injected_unique< //
+    IHandler,
+    dipp::service_lifetime::transient>;
+
+template<typename HandlerServiceTy>
+class Dispatcher
+{
+public:
+    Dispatcher(dipp::all_of<HandlerServiceTy> handlers)
+        : handlers(std::move(handlers))
+    {
+    }
+
+    std::vector<int> dispatch() const
+    {
+        std::vector<int> ids;
+        for (auto& handler : handlers)
+        {
+            ids.push_back((*handler)->id());
+        }
+        return ids;
+    }
+
+    std::vector<HandlerServiceTy> handlers;
+};
+
+using DispatcherService = dipp::injected< //
+    Dispatcher<HandlerService>,
+    dipp::service_lifetime::singleton,
+    dipp::dependency<dipp::all_of<HandlerService>>>;
+
+using TransientDispatcherService = dipp::injected< //
+    Dispatcher<TransientHandlerService>,
+    dipp::service_lifetime::transient,
+    dipp::dependency<dipp::all_of<TransientHandlerService>>>;
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenHandlers_WhenResolvingDispatcher_ThenEveryHandlerInjectedInOrder)
+{
+    // Given
+    dipp::service_collection collection;
+
+    collection.add_impl<HandlerService, AuditHandler>();
+    collection.add_impl<HandlerService, MetricsHandler>();
+    collection.add_impl<HandlerService, AuditHandler>();
+    collection.add<DispatcherService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    DispatcherService dispatcher = *services.get<DispatcherService>();
+
+    // Then
+    BOOST_TEST(dispatcher->dispatch() == std::vector<int>({1, 2, 1}),
+               boost::test_tools::per_element());
+
+    const IHandler& last_handler = *services.get<HandlerService>();
+    const IHandler& injected_handler = dispatcher->handlers.back();
+    BOOST_CHECK_EQUAL(&last_handler, &injected_handler);
+}
+
+BOOST_AUTO_TEST_CASE(GivenNoHandlers_WhenValidatingAndResolving_ThenDispatcherHasNoHandlers)
+{
+    // Given
+    dipp::service_collection collection;
+
+    collection.add<DispatcherService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    (void) services.validate();
+    DispatcherService dispatcher = *services.get<DispatcherService>();
+
+    // Then
+    BOOST_CHECK(services.is_validated());
+    BOOST_CHECK(dispatcher->handlers.empty());
+}
+
+BOOST_AUTO_TEST_CASE(GivenTransientHandlers_WhenResolvingTwice_ThenEachConstructionGetsNewHandlers)
+{
+    // Given
+    dipp::service_collection collection;
+
+    collection.add_impl<TransientHandlerService, AuditHandler>();
+    collection.add_impl<TransientHandlerService, MetricsHandler>();
+    collection.add<TransientDispatcherService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    TransientDispatcherService first = *services.get<TransientDispatcherService>();
+    TransientDispatcherService second = *services.get<TransientDispatcherService>();
+
+    // Then
+    BOOST_REQUIRE_EQUAL(first->handlers.size(), 2);
+    BOOST_REQUIRE_EQUAL(second->handlers.size(), 2);
+    BOOST_CHECK_NE(first->handlers[0].get().get(), second->handlers[0].get().get());
+    BOOST_TEST(second->dispatch() == std::vector<int>({1, 2}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(GivenHandlers_WhenGettingAllOf_ThenEveryHandlerReturned)
+{
+    // Given
+    dipp::service_collection collection;
+
+    collection.add_impl<HandlerService, AuditHandler>();
+    collection.add_impl<HandlerService, MetricsHandler>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    dipp::all_of<HandlerService> handlers = *services.get<dipp::all_of<HandlerService>>();
+
+    // Then
+    BOOST_REQUIRE_EQUAL(handlers.size(), 2);
+    BOOST_CHECK_EQUAL(handlers[0]->get()->id(), 1);
+    BOOST_CHECK_EQUAL(handlers[1]->get()->id(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,149 @@
+#define BOOST_TEST_MODULE Allocations_Test
+
+#include <boost/test/included/unit_test.hpp>
+#include <allocation_tracker.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(Allocations_Test)
+
+//
+
+struct Config
+{
+    int value = 1;
+};
+
+struct Session
+{
+    explicit Session(const Config& config)
+        : value(config.value)
+    {
+    }
+
+    int value;
+};
+
+using SingletonService = dipp::injected<Config, dipp::service_lifetime::singleton>;
+using ScopedService =
+    dipp::injected<Session, dipp::service_lifetime::scoped, dipp::dependency<SingletonService>>;
+using TransientService = dipp::
+    injected<Session, dipp::service_lifetime::transient, dipp::dependency<SingletonService>, 1>;
+
+static dipp::service_collection make_collection()
+{
+    dipp::service_collection collection;
+
+    collection.add<SingletonService>();
+    collection.add<ScopedService>();
+    collection.add<TransientService>();
+
+    return collection;
+}
+
+// Budgets of the default policy. A registration allocates its map node, the registration vector,
+// its metadata and its descriptor if larger than the small buffer, the first registration of a
+// service type also allocates its entry in the index of keys per type. A first resolution of a
+// singleton or scoped service allocates its instance, the owning vector and the lookup map node.
+static constexpr size_t registration_budget = 4;
+static constexpr size_t cached_construction_budget = 3;
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenServiceAdded_ThenWithinBudget)
+{
+    // Given
+    auto collection = make_collection();
+
+    // When
+    auto counts = dipp::support::count_allocations([&] { collection.add<SingletonService>(); });
+
+    // Then
+    BOOST_CHECK_LE(counts.allocations, registration_budget);
+}
+
+BOOST_AUTO_TEST_CASE(GivenProvider_WhenScopeCreated_ThenNoAllocation)
+{
+    // Given
+    dipp::service_provider services(make_collection());
+
+    // When
+    auto counts = dipp::support::count_allocations(
+        [&]
+        {
+            auto scope = services.create_scope();
+            (void) scope;
+        });
+
+    // Then
+    BOOST_CHECK_EQUAL(counts.allocations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(GivenProvider_WhenSingletonFirstResolved_ThenWithinBudget)
+{
+    // Given
+    dipp::service_provider services(make_collection());
+
+    // When
+    auto counts =
+        dipp::support::count_allocations([&] { (void) services.get<SingletonService>(); });
+
+    // Then
+    BOOST_CHECK_LE(counts.allocations, cached_construction_budget);
+}
+
+BOOST_AUTO_TEST_CASE(GivenScope_WhenScopedFirstResolved_ThenWithinBudget)
+{
+    // Given
+    dipp::service_provider services(make_collection());
+    (void) services.get<SingletonService>();
+    auto scope = services.create_scope();
+
+    // When
+    auto counts = dipp::support::count_allocations([&] { (void) scope.get<ScopedService>(); });
+
+    // Then
+    BOOST_CHECK_LE(counts.allocations, cached_construction_budget);
+}
+
+BOOST_AUTO_TEST_CASE(GivenResolvedServices_WhenResolvedAgain_ThenNoAllocation)
+{
+    // Given
+    dipp::service_provider services(make_collection());
+    auto scope = services.create_scope();
+    (void) scope.get<ScopedService>();
+    (void) scope.get<TransientService>();
+
+    // When
+    auto counts = dipp::support::count_allocations(
+        [&]
+        {
+            (void) scope.get<SingletonService>();
+            (void) scope.get<ScopedService>();
+            (void) scope.get<TransientService>();
+        });
+
+    // Then
+    BOOST_CHECK_EQUAL(counts.allocations, 0);
+}
+
+#ifdef DIPP_USE_EXPECTED
+BOOST_AUTO_TEST_CASE(GivenMissingService_WhenResolved_ThenErrorWithoutAllocation)
+{
+    using MissingService =
+        dipp::injected<Config, dipp::service_lifetime::transient, dipp::dependency<>, 2>;
+
+    // Given
+    dipp::service_provider services(make_collection());
+
+    // When
+    bool not_found = false;
+    auto counts = dipp::support::count_allocations(
+        [&] { not_found = services.get<MissingService>().error().is<dipp::service_not_found>(); });
+
+    // Then
+    BOOST_CHECK(not_found);
+    BOOST_CHECK_EQUAL(counts.allocations, 0);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,102 @@
+#define BOOST_TEST_MODULE BulkRegistration_Test
+
+#include <utility>
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(BulkRegistration_Test)
+
+struct Tenant
+{
+    explicit Tenant(int id)
+        : id(id)
+    {
+    }
+
+    int id;
+};
+
+using TenantService = dipp::injected<Tenant, dipp::service_lifetime::singleton>;
+using TenantRegistrations = std::vector<std::pair<TenantService::descriptor_type, size_t>>;
+
+static TenantRegistrations make_registrations(std::initializer_list<std::pair<int, size_t>> tenants)
+{
+    TenantRegistrations registrations;
+    for (auto [id, key] : tenants)
+    {
+        registrations.emplace_back(TenantService::descriptor_type::factory(id), key);
+    }
+    return registrations;
+}
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenRegistrationRange_WhenAddedInBulk_ThenResolvedLikeSingleAdds)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.reserve(4);
+
+    // When
+    collection.add_range(make_registrations({{1, 3}, {2, 1}, {3, 2}, {4, 1}}));
+    dipp::service_provider services(std::move(collection));
+
+    // Then
+    BOOST_CHECK_EQUAL(services.count<TenantService>(1), 2);
+    BOOST_CHECK_EQUAL(services.count_all<TenantService>(), 4);
+    BOOST_CHECK_EQUAL((*services.get<TenantService>(1))->id, 4);
+    BOOST_CHECK_EQUAL((*services.get<TenantService>(2))->id, 3);
+    BOOST_CHECK_EQUAL((*services.get<TenantService>(3))->id, 1);
+
+    auto keys = services.keys_of<TenantService>();
+    BOOST_TEST(std::vector<size_t>(keys.begin(), keys.end()) == std::vector<size_t>({3, 1, 2}),
+               boost::test_tools::per_element());
+
+    (void) services.validate();
+    BOOST_CHECK(services.is_validated());
+}
+
+BOOST_AUTO_TEST_CASE(GivenExistingRegistrations_WhenAddedInBulk_ThenAppendedAfterThem)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add(TenantService::descriptor_type::factory(1), 1);
+
+    // When
+    collection.add_range(make_registrations({{2, 1}, {3, 5}}));
+    dipp::service_provider services(std::move(collection));
+
+    // Then
+    BOOST_CHECK_EQUAL(services.count<TenantService>(1), 2);
+    BOOST_CHECK_EQUAL((*services.get<TenantService>(1))->id, 2);
+
+    std::vector<int> ids;
+    services.find_all_keys<TenantService>(
+        [&](size_t, dipp::service_getter<TenantService> getter)
+        { ids.push_back((*getter())->id); });
+    BOOST_TEST(ids == std::vector<int>({1, 2, 3}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(GivenRegistrationRange_WhenAddedToTwoCollections_ThenRangeIsCopied)
+{
+    // Given
+    auto registrations = make_registrations({{1, 1}, {2, 2}});
+    dipp::service_collection first_collection;
+    dipp::service_collection second_collection;
+
+    // When
+    first_collection.add_range(registrations);
+    second_collection.add_range(registrations);
+
+    dipp::service_provider first_services(std::move(first_collection));
+    dipp::service_provider second_services(std::move(second_collection));
+
+    // Then
+    BOOST_CHECK_EQUAL((*first_services.get<TenantService>(2))->id, 2);
+    BOOST_CHECK_EQUAL((*second_services.get<TenantService>(2))->id, 2);
+    BOOST_CHECK_NE(&(*first_services.get<TenantService>(2)).get(),
+                   &(*second_services.get<TenantService>(2)).get());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -95,7 +95,14 @@ BOOST_AUTO_TEST_CASE(GivenUnregisteredServices_WhenCheckingMultipleTypes_ThenCor
     BOOST_CHECK(!services.has<UnregisteredService1>());
     BOOST_CHECK(!services.has<UnregisteredService2>());
 
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+    // Test expected-based error handling
+    auto result1 = services.get<UnregisteredService1>();
+    BOOST_CHECK(result1.error().is<dipp::service_not_found>());
+
+    auto result2 = services.get<UnregisteredService2>();
+    BOOST_CHECK(result2.error().is<dipp::service_not_found>());
+#elif defined(DIPP_USE_RESULT)
     // Test result-based error handling
     auto result1 = services.get<UnregisteredService1>();
     BOOST_CHECK(result1.has_error());
@@ -133,7 +140,10 @@ BOOST_AUTO_TEST_CASE(GivenMissingDependency_WhenServiceRequested_ThenErrorHandle
     dipp::service_provider services(std::move(collection));
 
     // Then
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+    auto result = services.get<SimpleSubServiceType>();
+    BOOST_CHECK(result.error().is<dipp::service_not_found>());
+#elif defined(DIPP_USE_RESULT)
     bool found_service_not_found_error = false;
     boost::leaf::try_handle_some(
         [&]() -> boost::leaf::result<void>
@@ -258,7 +268,9 @@ BOOST_AUTO_TEST_CASE(GivenFactoryWithResultError_WhenServiceRequested_ThenErrorH
     collection.add<SimpleServiceType>(
         [](auto&) -> dipp::result<SimpleService>
         {
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+            return dipp::make_error(not_found_error());
+#elif defined(DIPP_USE_RESULT)
             return boost::leaf::new_error(not_found_error());
 #else
             throw not_found_error();
@@ -269,7 +281,10 @@ BOOST_AUTO_TEST_CASE(GivenFactoryWithResultError_WhenServiceRequested_ThenErrorH
     dipp::service_provider services(std::move(collection));
 
     // Then
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+    auto res = services.get<SimpleServiceType>();
+    BOOST_CHECK(res.error().is<not_found_error>());
+#elif defined(DIPP_USE_RESULT)
     bool found_error = false;
     boost::leaf::try_handle_some(
         [&]() -> boost::leaf::result<void>
@@ -299,7 +314,12 @@ BOOST_AUTO_TEST_CASE(GivenUnregisteredService_WhenRequested_ThenServiceNotFoundT
     // When / Then
     BOOST_CHECK_EQUAL(services.has<service>(), false);
 
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+
+    auto result = services.get<service>();
+    BOOST_CHECK(result.error().is<dipp::service_not_found>());
+
+#elif defined(DIPP_USE_RESULT)
 
     bool found_service_not_found_error = false;
 
@@ -354,7 +374,12 @@ BOOST_AUTO_TEST_CASE(GivenWrongServiceType_WhenRequested_ThenServiceNotFoundThro
     BOOST_CHECK_EQUAL(services.has<actual_injected>(), true);
     BOOST_CHECK_EQUAL(services.has<wrong_injected>(), false);
 
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+
+    auto result = services.get<wrong_injected>();
+    BOOST_CHECK(result.error().is<dipp::service_not_found>());
+
+#elif defined(DIPP_USE_RESULT)
 
     bool found_service_not_found_error = false;
 
@@ -436,7 +461,12 @@ BOOST_AUTO_TEST_CASE(GivenDependencyChainWithMissingIntermediate_WhenServiceRequ
     BOOST_CHECK(!services.has<MiddleServiceType>());
     BOOST_CHECK(services.has<TopServiceType>());
 
-#ifdef DIPP_USE_RESULT
+#if defined(DIPP_USE_EXPECTED)
+
+    auto result = services.get<TopServiceType>();
+    BOOST_CHECK(result.error().is<dipp::service_not_found>());
+
+#elif defined(DIPP_USE_RESULT)
 
     bool found_service_not_found_error = false;
 
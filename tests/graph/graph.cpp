@@ -0,0 +1,179 @@
+#define BOOST_TEST_MODULE Graph_Test
+
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(Graph_Test)
+
+//
+
+struct Config
+{
+};
+
+struct Database
+{
+    explicit Database(const Config&)
+    {
+    }
+};
+
+struct Cache
+{
+    explicit Cache(const Config&)
+    {
+    }
+};
+
+struct Repository
+{
+    Repository(const Database&, const Cache&)
+    {
+    }
+};
+
+struct Mailer
+{
+};
+
+struct Notifier
+{
+    explicit Notifier(const Mailer&)
+    {
+    }
+};
+
+using ConfigService = dipp::injected<Config, dipp::service_lifetime::singleton>;
+using DatabaseService =
+    dipp::injected<Database, dipp::service_lifetime::singleton, dipp::dependency<ConfigService>>;
+using CacheService =
+    dipp::injected<Cache, dipp::service_lifetime::scoped, dipp::dependency<ConfigService>>;
+using RepositoryService = dipp::injected<Repository,
+                                         dipp::service_lifetime::transient,
+                                         dipp::dependency<DatabaseService, CacheService>>;
+
+using MailerService = dipp::injected<Mailer, dipp::service_lifetime::singleton>;
+using NotifierService =
+    dipp::injected<Notifier, dipp::service_lifetime::scoped, dipp::dependency<MailerService>>;
+
+static dipp::service_collection make_collection()
+{
+    dipp::service_collection collection;
+    collection.add<ConfigService>();
+    collection.add<DatabaseService>();
+    collection.add<CacheService>();
+    collection.add<RepositoryService>();
+    return collection;
+}
+
+static const dipp::service_graph_node& find_node(const dipp::service_graph& graph,
+                                                 const char* type_name)
+{
+    for (auto& node : graph.nodes())
+    {
+        if (std::string_view(node.type_name) == type_name)
+        {
+            return node;
+        }
+    }
+    throw std::runtime_error("node not found");
+}
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenDiamondGraph_WhenExported_ThenStatisticsComputed)
+{
+    // Given
+    auto collection = make_collection();
+
+    // When
+    auto graph = collection.export_graph();
+
+    // Then
+    BOOST_CHECK_EQUAL(graph.nodes().size(), 4);
+    BOOST_CHECK_EQUAL(graph.edge_count(), 4);
+    BOOST_CHECK_EQUAL(graph.max_depth(), 2);
+    BOOST_CHECK_EQUAL(graph.max_fan_in(), 2);
+    BOOST_CHECK_EQUAL(graph.max_fan_out(), 2);
+
+    auto& config = find_node(graph, dipp::type_name<Config>());
+    BOOST_CHECK_EQUAL(config.fan_in, 2);
+    BOOST_CHECK_EQUAL(config.fan_out, 0);
+    BOOST_CHECK_EQUAL(config.depth, 0);
+    BOOST_CHECK(config.lifetime == dipp::service_lifetime::singleton);
+
+    auto& repository = find_node(graph, dipp::type_name<Repository>());
+    BOOST_CHECK_EQUAL(repository.fan_in, 0);
+    BOOST_CHECK_EQUAL(repository.fan_out, 2);
+    BOOST_CHECK_EQUAL(repository.depth, 2);
+    BOOST_CHECK_EQUAL(repository.subgraph_size, 3);
+    BOOST_CHECK(repository.lifetime == dipp::service_lifetime::transient);
+}
+
+BOOST_AUTO_TEST_CASE(GivenMissingDependency_WhenExported_ThenNodeUnregistered)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<NotifierService>();
+
+    // When
+    auto graph = collection.export_graph();
+
+    // Then
+    BOOST_REQUIRE_EQUAL(graph.nodes().size(), 2);
+
+    auto& notifier = find_node(graph, dipp::type_name<Notifier>());
+    BOOST_CHECK(notifier.registered);
+    BOOST_CHECK_EQUAL(notifier.depth, 1);
+
+    auto& mailer = find_node(graph, dipp::type_name<Mailer>());
+    BOOST_CHECK(!mailer.registered);
+    BOOST_CHECK_EQUAL(mailer.registrations, 0);
+    BOOST_CHECK_EQUAL(mailer.fan_in, 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRepeatedRegistration_WhenExported_ThenRegistrationsCounted)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<MailerService>();
+    collection.add<MailerService>();
+    collection.add<ConfigService>();
+
+    // When
+    auto graph = collection.export_graph();
+
+    // Then
+    BOOST_REQUIRE_EQUAL(graph.nodes().size(), 2);
+    BOOST_CHECK_EQUAL(find_node(graph, dipp::type_name<Mailer>()).registrations, 2);
+}
+
+BOOST_AUTO_TEST_CASE(GivenProvider_WhenExportedAsDot_ThenEdgesWritten)
+{
+    // Given
+    dipp::service_provider services(make_collection());
+
+    // When
+    auto dot = services.export_graph().to_dot();
+
+    // Then
+    BOOST_CHECK(dot.starts_with("digraph dipp {"));
+    BOOST_CHECK(dot.find("->") != std::string::npos);
+    BOOST_CHECK(dot.find("transient") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(GivenCollection_WhenExportedAsJson_ThenStatsWritten)
+{
+    // Given
+    auto collection = make_collection();
+
+    // When
+    auto json = collection.export_graph().to_json();
+
+    // Then
+    BOOST_CHECK(json.starts_with("{\"nodes\":["));
+    BOOST_CHECK(json.find("\"stats\":{\"nodes\":4,\"edges\":4,\"max_depth\":2,\"max_fan_in\":2,"
+                          "\"max_fan_out\":2}") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -237,4 +237,84 @@ BOOST_AUTO_TEST_CASE(
     BOOST_CHECK(primaryConnections.contains("conn3"));
 }
 
+BOOST_AUTO_TEST_CASE(GivenServicesWithKeys_WhenEnumeratingKeys_ThenKeysInRegistrationOrder)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<SecondaryDbService>("backup");
+    collection.add<PrimaryDbService>("conn1");
+    collection.add<PrimaryDbService>("conn2");
+    collection.add<RedisCache>("redis-cache");
+
+    // When
+    dipp::service_provider services(std::move(collection));
+    auto keys = services.keys_of<PrimaryDbService>();
+
+    // Then
+    std::vector<size_t> expected{dipp::key("secondary"), dipp::key("primary")};
+    BOOST_CHECK_EQUAL_COLLECTIONS(keys.begin(), keys.end(), expected.begin(), expected.end());
+    BOOST_CHECK(services.keys_of<RedisCache>().size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(GivenServicesWithKeys_WhenFindingAllKeys_ThenEveryRegistrationVisited)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<PrimaryDbService>("conn1");
+    collection.add<PrimaryDbService>("conn2");
+    collection.add<SecondaryDbService>("backup");
+    collection.add<RedisCache>("redis-cache");
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    std::set<std::pair<size_t, std::string>> connections;
+    services.find_all_keys<PrimaryDbService>(
+        [&connections](size_t key, dipp::service_getter<PrimaryDbService> serviceGetter)
+        {
+            const DatabaseConnection& dbConn = *serviceGetter();
+            connections.emplace(key, dbConn.connectionString);
+        });
+
+    // Then
+    BOOST_CHECK_EQUAL(connections.size(), 3);
+    BOOST_CHECK(connections.contains({dipp::key("primary"), "conn1"}));
+    BOOST_CHECK(connections.contains({dipp::key("primary"), "conn2"}));
+    BOOST_CHECK(connections.contains({dipp::key("secondary"), "backup"}));
+    BOOST_CHECK_EQUAL(services.count_all<PrimaryDbService>(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenStringsCollidingWithPolynomialHash_WhenHashed_ThenKeysDiffer)
+{
+    // Given
+    // "Aa" and "BB" share the same hash * 31 + c hash
+    constexpr size_t first = dipp::key("Aa");
+    constexpr size_t second = dipp::key("BB");
+
+    // When
+    std::string runtime_first = "Aa";
+
+    // Then
+    BOOST_CHECK_NE(first, second);
+    BOOST_CHECK_EQUAL(dipp::key(runtime_first), first);
+}
+
+#ifndef NDEBUG
+BOOST_AUTO_TEST_CASE(GivenTwoStringsRecordedForSameKey_WhenCheckingRegistry_ThenCollisionDetected)
+{
+    // Given
+    constexpr size_t key = 0x5eed;
+    BOOST_CHECK(dipp::details::key_registry::record("first", key));
+    BOOST_CHECK(dipp::details::key_registry::record("first", key));
+
+    // When
+    bool recorded = dipp::details::key_registry::record("second", key);
+
+    // Then
+    BOOST_CHECK(!recorded);
+    BOOST_CHECK(dipp::details::key_registry::collides(key));
+    BOOST_CHECK(!dipp::details::key_registry::collides(dipp::key("primary")));
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
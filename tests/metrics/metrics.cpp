@@ -0,0 +1,96 @@
+#define BOOST_TEST_MODULE Metrics_Test
+
+#include <array>
+#include <algorithm>
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(Metrics_Test)
+
+//
+
+struct Window
+{
+};
+
+struct Frame
+{
+    std::array<int, 64> pixels{};
+};
+
+using WindowService = dipp::injected<Window,
+                                     dipp::service_lifetime::singleton,
+                                     dipp::dependency<>,
+                                     0,
+                                     dipp::metrics_service_scope>;
+using FrameService = dipp::injected<Frame,
+                                    dipp::service_lifetime::scoped,
+                                    dipp::dependency<>,
+                                    0,
+                                    dipp::metrics_service_scope>;
+
+static const dipp::service_metrics& find_metrics(const std::vector<dipp::service_metrics>& metrics,
+                                                 const char* type_name)
+{
+    auto iter = std::ranges::find_if(metrics,
+                                     [&](const dipp::service_metrics& entry)
+                                     { return std::string_view(entry.type_name) == type_name; });
+    BOOST_REQUIRE(iter != metrics.end());
+    return *iter;
+}
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenSingleton_WhenResolvedRepeatedly_ThenCountsAggregated)
+{
+    // Given
+    dipp::metrics_service_collection collection;
+    collection.add<WindowService>();
+
+    dipp::metrics_service_provider services(std::move(collection));
+
+    // When
+    for (int i = 0; i < 3; i++)
+    {
+        (void) services.get<WindowService>();
+    }
+
+    // Then
+    auto snapshot = services.metrics_snapshot();
+    auto& metrics = find_metrics(snapshot, dipp::type_name<Window>());
+
+    BOOST_CHECK_EQUAL(metrics.resolutions, 3);
+    BOOST_CHECK_EQUAL(metrics.constructions, 1);
+    BOOST_CHECK_EQUAL(metrics.cache_hits, 2);
+    BOOST_CHECK_EQUAL(metrics.errors, 0);
+    BOOST_CHECK_EQUAL(metrics.allocations, 0);
+    BOOST_CHECK(metrics.max_construction_time <= metrics.total_construction_time);
+}
+
+BOOST_AUTO_TEST_CASE(GivenLargeScopedService_WhenResolvedInScopes_ThenAllocationsCounted)
+{
+    // Given
+    dipp::metrics_service_collection collection;
+    collection.add<FrameService>();
+
+    dipp::metrics_service_provider services(std::move(collection));
+
+    // When
+    for (int i = 0; i < 2; i++)
+    {
+        auto scope = services.create_scope();
+        (void) scope.get<FrameService>();
+    }
+
+    // Then
+    auto snapshot = services.metrics_snapshot();
+    auto& metrics = find_metrics(snapshot, dipp::type_name<Frame>());
+
+    BOOST_CHECK_EQUAL(metrics.resolutions, 2);
+    BOOST_CHECK_EQUAL(metrics.constructions, 2);
+    BOOST_CHECK_EQUAL(metrics.allocations, 2);
+}
+
+//
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -275,6 +275,45 @@ BOOST_AUTO_TEST_CASE(GivenLargeObject_WhenMoved_ThenEfficientlyHandled)
     BOOST_CHECK_EQUAL(service.get_sum(), expected_sum);
 }
 
+BOOST_AUTO_TEST_CASE(GivenLargeTransientService_WhenRequested_ThenConstructedOnceAndMovedOnce)
+{
+    struct LargeTransient
+    {
+        std::array<int, 64> data{};
+
+        explicit LargeTransient(int value)
+        {
+            data.fill(value);
+            MoveTracker::constructor_calls++;
+        }
+
+        LargeTransient(const LargeTransient&) = delete;
+
+        LargeTransient(LargeTransient&& other) noexcept
+            : data(other.data)
+        {
+            MoveTracker::move_constructor_calls++;
+        }
+    };
+
+    using LargeTransientService = dipp::injected<LargeTransient, dipp::service_lifetime::transient>;
+
+    // Given
+    dipp::service_collection collection;
+    collection.add<LargeTransientService>(7);
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    auto service = services.get<LargeTransientService>();
+
+    // Then
+    // The value is constructed in place and moved only once into the injected wrapper
+    BOOST_CHECK_EQUAL(MoveTracker::constructor_calls, 1);
+    BOOST_CHECK_EQUAL(MoveTracker::move_constructor_calls, 1);
+    BOOST_CHECK_EQUAL(service.value()->data[63], 7);
+}
+
 BOOST_AUTO_TEST_CASE(GivenServiceProvider_WhenMoved_ThenFunctionalityPreserved)
 {
     // Given
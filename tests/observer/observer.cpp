@@ -0,0 +1,151 @@
+#define BOOST_TEST_MODULE Observer_Test
+
+#include <string>
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(Observer_Test)
+
+//
+
+struct recording_observer
+{
+    template<typename InjectableTy>
+    void on_lookup(const dipp::details::type_key_pair&)
+    {
+        events.push_back("lookup");
+    }
+
+    template<typename InjectableTy>
+    void on_cache_hit(const dipp::details::type_key_pair&)
+    {
+        events.push_back("hit");
+    }
+
+    template<typename InjectableTy>
+    void on_construct_begin(const dipp::details::type_key_pair&)
+    {
+        events.push_back("begin");
+    }
+
+    template<typename InjectableTy>
+    void on_construct_end(const dipp::details::type_key_pair&)
+    {
+        events.push_back("end");
+    }
+
+    template<typename InjectableTy>
+    void on_allocation(const dipp::details::type_key_pair&)
+    {
+        events.push_back("allocation");
+    }
+
+    template<typename InjectableTy>
+    void on_error(const dipp::details::type_key_pair&)
+    {
+        events.push_back("error");
+    }
+
+    std::vector<std::string> events;
+};
+
+struct recording_policy
+{
+    using service_map_type = dipp::default_service_policy::service_map_type;
+    using observer_type = recording_observer;
+};
+
+using recording_collection = dipp::base_service_collection<recording_policy>;
+using recording_provider = dipp::base_service_provider<recording_policy,
+                                                       dipp::default_service_storage_memory_type,
+                                                       dipp::default_service_storage_memory_type>;
+using recording_scope = recording_provider::scope_type;
+
+//
+
+struct Window
+{
+};
+
+struct Engine
+{
+    explicit Engine(Window&)
+    {
+    }
+};
+
+using WindowService =
+    dipp::injected<Window, dipp::service_lifetime::singleton, dipp::dependency<>, 0, recording_scope>;
+using EngineService = dipp::injected<Engine,
+                                     dipp::service_lifetime::transient,
+                                     dipp::dependency<WindowService>,
+                                     0,
+                                     recording_scope>;
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenSingleton_WhenResolvedTwice_ThenConstructionThenCacheHitObserved)
+{
+    // Given
+    recording_collection collection;
+    collection.add<WindowService>();
+
+    recording_provider services(std::move(collection));
+
+    // When
+    (void) services.get<WindowService>();
+    (void) services.get<WindowService>();
+
+    // Then
+    std::vector<std::string> expected{"lookup", "begin", "end", "lookup", "hit"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(services.observer().events.begin(),
+                                  services.observer().events.end(),
+                                  expected.begin(),
+                                  expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenTransientWithDependency_WhenResolved_ThenNestedConstructionObserved)
+{
+    // Given
+    recording_collection collection;
+    collection.add<WindowService>();
+    collection.add<EngineService>();
+
+    recording_provider services(std::move(collection));
+
+    // When
+    (void) services.get<EngineService>();
+
+    // Then
+    std::vector<std::string> expected{"lookup", "begin", "lookup", "begin", "end", "end"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(services.observer().events.begin(),
+                                  services.observer().events.end(),
+                                  expected.begin(),
+                                  expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMissingService_WhenResolved_ThenErrorObserved)
+{
+    // Given
+    recording_collection collection;
+    recording_provider services(std::move(collection));
+
+    // When
+#ifdef DIPP_USE_RESULT
+    BOOST_CHECK(services.get<WindowService>().has_error());
+#else
+    BOOST_CHECK_THROW((void) services.get<WindowService>(), dipp::service_not_found);
+#endif
+
+    // Then
+    std::vector<std::string> expected{"lookup", "error"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(services.observer().events.begin(),
+                                  services.observer().events.end(),
+                                  expected.begin(),
+                                  expected.end());
+}
+
+//
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
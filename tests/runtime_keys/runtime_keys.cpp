@@ -0,0 +1,138 @@
+#define BOOST_TEST_MODULE RuntimeKeys_Test
+
+#include <string>
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(RuntimeKeys_Test)
+
+struct TenantConnection
+{
+    explicit TenantConnection(size_t tenant)
+        : tenant(tenant)
+    {
+        ++Constructions;
+    }
+
+    size_t tenant;
+
+    static inline int Constructions = 0;
+};
+
+struct ShardWriter
+{
+    size_t shard;
+};
+
+using TenantConnectionService =
+    dipp::injected<TenantConnection, dipp::service_lifetime::singleton>;
+using ShardWriterService = dipp::injected<ShardWriter, dipp::service_lifetime::transient>;
+
+static constexpr size_t TenantCount = 4;
+
+static dipp::service_collection make_tenants()
+{
+    dipp::service_collection collection;
+    for (size_t tenant = 0; tenant < TenantCount; ++tenant)
+    {
+        collection.add<TenantConnectionService>([tenant](auto&)
+                                                { return TenantConnection(tenant); },
+                                                tenant);
+        collection.add<ShardWriterService>([tenant](auto&) { return ShardWriter{tenant}; },
+                                           tenant);
+    }
+    return collection;
+}
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenRuntimeKeys_WhenResolvedByKey_ThenMatchingServiceReturned)
+{
+    // Given
+    dipp::service_provider services(make_tenants());
+
+    for (size_t tenant = 0; tenant < TenantCount; ++tenant)
+    {
+        // When
+        TenantConnectionService connection = *services.get<TenantConnectionService>(tenant);
+        TenantConnectionService again = *services.get<TenantConnectionService>(tenant);
+
+        // Then
+        BOOST_CHECK_EQUAL(connection->tenant, tenant);
+        BOOST_CHECK_EQUAL(&connection.get(), &again.get());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GivenRuntimeKeys_WhenCheckingByKey_ThenOnlyAddedKeysFound)
+{
+    // Given
+    dipp::service_provider services(make_tenants());
+
+    // When
+    bool has_first = services.has<TenantConnectionService>(0);
+    bool has_last = services.has<TenantConnectionService>(TenantCount - 1);
+    bool has_missing = services.has<TenantConnectionService>(TenantCount);
+
+    // Then
+    BOOST_CHECK(has_first);
+    BOOST_CHECK(has_last);
+    BOOST_CHECK(!has_missing);
+    BOOST_CHECK_EQUAL(services.count<TenantConnectionService>(1), 1);
+    BOOST_CHECK_EQUAL(services.count<TenantConnectionService>(TenantCount), 0);
+    BOOST_CHECK_EQUAL(services.count_all<TenantConnectionService>(), TenantCount);
+}
+
+BOOST_AUTO_TEST_CASE(GivenDenseIndex_WhenResolvedRepeatedly_ThenEachSingletonConstructedOnce)
+{
+    // Given
+    dipp::service_provider services(make_tenants());
+    dipp::dense_service_index<TenantConnectionService> tenants(services.root_scope(),
+                                                               TenantCount);
+    TenantConnection::Constructions = 0;
+
+    // When
+    for (int request = 0; request < 3; ++request)
+    {
+        for (size_t tenant = 0; tenant < TenantCount; ++tenant)
+        {
+            TenantConnectionService connection = *tenants.get(tenant);
+            BOOST_CHECK_EQUAL(connection->tenant, tenant);
+        }
+    }
+
+    // Then
+    BOOST_CHECK_EQUAL(tenants.size(), TenantCount);
+    BOOST_CHECK_EQUAL(TenantConnection::Constructions, TenantCount);
+    BOOST_CHECK_EQUAL(&(*tenants[2]).get(), &(*services.get<TenantConnectionService>(2)).get());
+}
+
+BOOST_AUTO_TEST_CASE(GivenDenseIndexSmallerThanKeys_WhenResolvingKeyPastSize_ThenResolvedFromScope)
+{
+    // Given
+    dipp::service_provider services(make_tenants());
+    dipp::dense_service_index<TenantConnectionService> tenants(services.root_scope(), 2);
+
+    // When
+    TenantConnectionService connection = *tenants.get(3);
+
+    // Then
+    BOOST_CHECK_EQUAL(connection->tenant, 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenDenseIndexOfTransientService_WhenResolved_ThenNewInstanceReturned)
+{
+    // Given
+    dipp::service_provider services(make_tenants());
+    dipp::dense_service_index<ShardWriterService> shards(services.root_scope(), TenantCount);
+
+    // When
+    ShardWriterService first = *shards.get(1);
+    ShardWriterService second = *shards.get(1);
+
+    // Then
+    BOOST_CHECK_EQUAL(first->shard, 1);
+    BOOST_CHECK_EQUAL(second->shard, 1);
+    BOOST_CHECK_NE(&first.get(), &second.get());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <dipp/dipp.hpp>
+
+// The plugins are built with hidden visibility, so each shared library has its own copy of the
+// type information of the services below
+#if defined(_WIN32)
+    #ifdef DIPP_TEST_PLUGIN_EXPORT
+        #define DIPP_TEST_PLUGIN_API __declspec(dllexport)
+    #else
+        #define DIPP_TEST_PLUGIN_API __declspec(dllimport)
+    #endif
+#else
+    #define DIPP_TEST_PLUGIN_API __attribute__((visibility("default")))
+#endif
+
+namespace SharedLibrary_Test
+{
+    struct PluginConfig
+    {
+        int value = 42;
+    };
+
+    struct PluginGreeter
+    {
+        explicit PluginGreeter(const PluginConfig& config)
+            : config(config)
+        {
+        }
+
+        const PluginConfig& config;
+    };
+
+    using PluginConfigService = dipp::injected<PluginConfig, dipp::service_lifetime::singleton>;
+    using PluginGreeterService = dipp::injected<PluginGreeter,
+                                                dipp::service_lifetime::transient,
+                                                dipp::dependency<PluginConfigService>>;
+}
+
+/// <summary>
+/// Registers PluginConfigService from the registering plugin.
+/// </summary>
+DIPP_TEST_PLUGIN_API void register_plugin_services(dipp::service_collection& collection);
+
+/// <summary>
+/// Resolves PluginConfigService from the consuming plugin.
+/// </summary>
+DIPP_TEST_PLUGIN_API const SharedLibrary_Test::PluginConfig* resolve_plugin_config(
+    dipp::service_provider& services);
+
+/// <summary>
+/// Resolves PluginGreeterService from the consuming plugin.
+/// </summary>
+DIPP_TEST_PLUGIN_API int resolve_plugin_greeting(dipp::service_provider& services);
\ No newline at end of file
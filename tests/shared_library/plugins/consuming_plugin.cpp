@@ -0,0 +1,15 @@
+#include "../plugin_services.hpp"
+
+const SharedLibrary_Test::PluginConfig* resolve_plugin_config(dipp::service_provider& services)
+{
+    SharedLibrary_Test::PluginConfigService config =
+        *services.get<SharedLibrary_Test::PluginConfigService>();
+    return &config.get();
+}
+
+int resolve_plugin_greeting(dipp::service_provider& services)
+{
+    SharedLibrary_Test::PluginGreeterService greeter =
+        *services.get<SharedLibrary_Test::PluginGreeterService>();
+    return greeter->config.value;
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "../plugin_services.hpp"
+
+void register_plugin_services(dipp::service_collection& collection)
+{
+    collection.add<SharedLibrary_Test::PluginConfigService>();
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#define BOOST_TEST_MODULE SharedLibrary_Test
+
+#include <boost/test/included/unit_test.hpp>
+#include "plugin_services.hpp"
+
+BOOST_AUTO_TEST_SUITE(SharedLibrary_Test)
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenServiceRegisteredInPlugin_WhenResolvedByApplication_ThenFound)
+{
+    // Given
+    dipp::service_collection collection;
+    register_plugin_services(collection);
+
+    // When
+    dipp::service_provider services(std::move(collection));
+    PluginConfigService config = *services.get<PluginConfigService>();
+
+    // Then
+    BOOST_CHECK_EQUAL(config->value, 42);
+}
+
+BOOST_AUTO_TEST_CASE(GivenServiceResolvedByApplication_WhenResolvedByOtherPlugin_ThenSameInstance)
+{
+    // Given
+    dipp::service_collection collection;
+    register_plugin_services(collection);
+
+    dipp::service_provider services(std::move(collection));
+    PluginConfigService config = *services.get<PluginConfigService>();
+
+    // When
+    auto plugin_config = resolve_plugin_config(services);
+
+    // Then
+    BOOST_CHECK_EQUAL(plugin_config, &config.get());
+}
+
+BOOST_AUTO_TEST_CASE(GivenDependencyFromPlugin_WhenResolvedByOtherPlugin_ThenInjected)
+{
+    // Given
+    dipp::service_collection collection;
+    register_plugin_services(collection);
+    collection.add<PluginGreeterService>();
+
+    // When
+    dipp::service_provider services(std::move(collection));
+    int greeting = resolve_plugin_greeting(services);
+
+    // Then
+    BOOST_CHECK_EQUAL(greeting, 42);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,88 @@
+#define BOOST_TEST_MODULE SharedRef_Test
+
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(SharedRef_Test)
+
+//
+
+struct Logger
+{
+    int level = 3;
+};
+
+using LoggerService = dipp::injected_shared<Logger, dipp::service_lifetime::singleton>;
+using LoggerRefService = dipp::injected_shared_ref<Logger, dipp::service_lifetime::singleton>;
+
+struct Handler
+{
+    explicit Handler(Logger& logger)
+        : logger(logger)
+    {
+    }
+
+    Logger& logger;
+};
+
+using HandlerService = dipp::
+    injected<Handler, dipp::service_lifetime::scoped, dipp::dependency<LoggerRefService>>;
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenSharedService_WhenBorrowed_ThenReferenceCountUnchanged)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<LoggerRefService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    LoggerRefService first = *services.get<LoggerRefService>();
+    LoggerRefService second = *services.get<LoggerRefService>();
+
+    // Then
+    BOOST_CHECK_EQUAL(first.shared().use_count(), 1);
+    BOOST_CHECK_EQUAL(first.ptr(), second.ptr());
+    BOOST_CHECK_EQUAL(first->level, 3);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSharedRegistration_WhenBorrowed_ThenSameInstanceResolved)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<LoggerService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    LoggerService owned = *services.get<LoggerService>();
+    LoggerRefService borrowed = *services.get<LoggerRefService>();
+
+    // Then
+    BOOST_CHECK_EQUAL(owned->get(), borrowed.ptr());
+    BOOST_CHECK_EQUAL(&owned.get(), &borrowed.shared());
+}
+
+BOOST_AUTO_TEST_CASE(GivenBorrowedDependency_WhenInjected_ThenObjectReferenceForwarded)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<LoggerService>();
+    collection.add<HandlerService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    Handler& handler = *services.get<HandlerService>();
+    LoggerRefService logger = *services.get<LoggerRefService>();
+
+    // Then
+    BOOST_CHECK_EQUAL(&handler.logger, logger.ptr());
+    BOOST_CHECK_EQUAL(logger.shared().use_count(), 1);
+}
+
+//
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
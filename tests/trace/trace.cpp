@@ -0,0 +1,88 @@
+#define BOOST_TEST_MODULE Trace_Test
+
+#include <sstream>
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(Trace_Test)
+
+//
+
+struct Window
+{
+};
+
+struct Engine
+{
+    explicit Engine(Window&)
+    {
+    }
+};
+
+using WindowService = dipp::injected<Window,
+                                     dipp::service_lifetime::singleton,
+                                     dipp::dependency<>,
+                                     0,
+                                     dipp::trace_service_scope>;
+using EngineService = dipp::injected<Engine,
+                                     dipp::service_lifetime::scoped,
+                                     dipp::dependency<WindowService>,
+                                     dipp::key("main"),
+                                     dipp::trace_service_scope>;
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenNestedServices_WhenResolved_ThenDependencySpanInsideParentSpan)
+{
+    // Given
+    dipp::trace_service_collection collection;
+    collection.add<WindowService>();
+    collection.add<EngineService>();
+
+    dipp::trace_service_provider services(std::move(collection));
+
+    // When
+    (void) services.get<EngineService>();
+    (void) services.get<EngineService>();
+
+    // Then
+    auto events = services.observer().events();
+    BOOST_REQUIRE_EQUAL(events.size(), 2);
+
+    // the dependency finishes first, within the span of the engine
+    auto& window = events[0];
+    auto& engine = events[1];
+
+    BOOST_CHECK_EQUAL(std::string_view(window.type_name), dipp::type_name<Window>());
+    BOOST_CHECK_EQUAL(std::string_view(engine.type_name), dipp::type_name<Engine>());
+    BOOST_CHECK_EQUAL(engine.key, dipp::key("main"));
+    BOOST_CHECK(engine.lifetime == dipp::service_lifetime::scoped);
+    BOOST_CHECK(engine.start <= window.start);
+    BOOST_CHECK(window.start + window.duration <= engine.start + engine.duration);
+    BOOST_CHECK_EQUAL(window.thread_id, engine.thread_id);
+}
+
+BOOST_AUTO_TEST_CASE(GivenRecordedSpans_WhenWritten_ThenChromeTraceEventsProduced)
+{
+    // Given
+    dipp::trace_service_collection collection;
+    collection.add<WindowService>();
+
+    dipp::trace_service_provider services(std::move(collection));
+    (void) services.get<WindowService>();
+
+    // When
+    std::ostringstream stream;
+    services.observer().write_chrome_trace(stream);
+
+    // Then
+    auto json = stream.str();
+    BOOST_CHECK(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[{"));
+    BOOST_CHECK(json.find("\"ph\":\"X\"") != std::string::npos);
+    BOOST_CHECK(json.find("\"lifetime\":\"singleton\"") != std::string::npos);
+    BOOST_CHECK(json.ends_with("}]}"));
+}
+
+//
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,197 @@
+#define BOOST_TEST_MODULE Validation_Test
+
+#include <boost/test/included/unit_test.hpp>
+#include <dipp/dipp.hpp>
+
+BOOST_AUTO_TEST_SUITE(Validation_Test)
+
+//
+
+struct Config
+{
+    int value = 7;
+};
+
+struct Database
+{
+    explicit Database(const Config& config)
+        : value(config.value)
+    {
+    }
+
+    int value;
+};
+
+struct Repository
+{
+    explicit Repository(const Database& database)
+        : value(database.value)
+    {
+    }
+
+    int value;
+};
+
+using ConfigService = dipp::injected<Config, dipp::service_lifetime::singleton>;
+using DatabaseService =
+    dipp::injected<Database, dipp::service_lifetime::scoped, dipp::dependency<ConfigService>>;
+using RepositoryService = dipp::
+    injected<Repository, dipp::service_lifetime::transient, dipp::dependency<DatabaseService>>;
+
+// the same service registered with another lifetime, so with another descriptor
+using ScopedConfigService = dipp::injected<Config, dipp::service_lifetime::scoped>;
+
+// decorates the config registered under the same handle, which depends on itself
+using DecoratedConfigService =
+    dipp::injected<Config, dipp::service_lifetime::singleton, dipp::dependency<ConfigService>>;
+
+template<typename FnTy>
+static bool is_invalid(FnTy&& validate)
+{
+#ifdef DIPP_USE_RESULT
+    return validate().has_error();
+#else
+    try
+    {
+        (void) validate();
+        return false;
+    }
+    catch (const dipp::base_error&)
+    {
+        return true;
+    }
+#endif
+}
+
+//
+
+BOOST_AUTO_TEST_CASE(GivenCompleteGraph_WhenValidated_ThenResolvesUnchecked)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<ConfigService>();
+    collection.add<DatabaseService>();
+    collection.add<RepositoryService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    bool invalid = is_invalid([&] { return services.validate(); });
+
+    // Then
+    BOOST_REQUIRE(!invalid);
+    BOOST_CHECK(services.is_validated());
+
+    RepositoryService first = *services.get<RepositoryService>();
+    RepositoryService second = *services.get<RepositoryService>();
+    BOOST_CHECK_EQUAL(first->value, 7);
+    BOOST_CHECK_EQUAL(second->value, 7);
+
+    auto scope = services.create_scope();
+    DatabaseService database = *scope.get<DatabaseService>();
+    DatabaseService cached = *scope.get<DatabaseService>();
+    BOOST_CHECK_EQUAL(database->value, 7);
+    BOOST_CHECK_EQUAL(&database.get(), &cached.get());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMissingDependency_WhenValidated_ThenFails)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<DatabaseService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    bool invalid = is_invalid([&] { return services.validate(); });
+
+    // Then
+    BOOST_CHECK(invalid);
+    BOOST_CHECK(!services.is_validated());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMismatchedDependencyLifetime_WhenValidated_ThenFails)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<ScopedConfigService>();
+    collection.add<DatabaseService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    bool invalid = is_invalid([&] { return services.validate(); });
+
+    // Then
+    BOOST_CHECK(invalid);
+    BOOST_CHECK(!services.is_validated());
+}
+
+BOOST_AUTO_TEST_CASE(GivenMixedRegistrationsOfOneService_WhenValidated_ThenFails)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<ConfigService>();
+    collection.add<ScopedConfigService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+    bool invalid = is_invalid([&] { return services.validate(); });
+
+    // Then
+    BOOST_CHECK(invalid);
+}
+
+BOOST_AUTO_TEST_CASE(GivenSelfDependency_WhenValidated_ThenCycleReported)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<DecoratedConfigService>();
+
+    dipp::service_provider services(std::move(collection));
+
+    // When
+#if defined(DIPP_USE_EXPECTED)
+    auto result = services.validate();
+
+    // Then
+    BOOST_CHECK(result.error().is<dipp::circular_dependency>());
+#elif defined(DIPP_USE_RESULT)
+    bool found_cycle = false;
+    boost::leaf::try_handle_some(
+        [&]() -> boost::leaf::result<void>
+        {
+            auto result = services.validate();
+            if (!result.has_value())
+            {
+                return result.error();
+            }
+            return {};
+        },
+        [&](const dipp::circular_dependency&) { found_cycle = true; });
+
+    // Then
+    BOOST_CHECK(found_cycle);
+#else
+    // Then
+    BOOST_CHECK_THROW((void) services.validate(), dipp::circular_dependency);
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(GivenValidatedCollection_WhenServiceAdded_ThenValidationReset)
+{
+    // Given
+    dipp::service_collection collection;
+    collection.add<ConfigService>();
+    bool invalid = is_invalid([&] { return collection.validate(); });
+    BOOST_REQUIRE(!invalid);
+
+    // When
+    collection.add<DatabaseService>();
+
+    // Then
+    BOOST_CHECK(!collection.is_validated());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -4,6 +4,10 @@ add_rules("mode.debug", "mode.release")
 --
 
 set_languages("$(cpp-version)")
+if not has_config("rtti") then
+    add_cxxflags("-fno-rtti", {tools = {"gcc", "clang"}})
+    add_cxxflags("/GR-", {tools = {"cl", "clang_cl"}})
+end
 add_extrafiles(".clang-format")
 
 --
@@ -11,6 +15,10 @@ add_extrafiles(".clang-format")
 includes("project/packages.lua")
 includes("project/project.lua")
 
+if is_config("test", true) or is_config("benchmark", true) then
+    includes("project/support.lua")
+end
+
 if is_config("test", true) then
     includes("project/tests.lua")
 end